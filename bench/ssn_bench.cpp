@@ -0,0 +1,395 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_opengl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "rng_t.h"
+
+#include "ssn_modes.h"
+#include "ssn_scratch.h"
+#include "ssn_data.h"
+#include "ssn.h"
+
+// NOTE(JRC): Each benchmark is run as a series of samples, where each sample
+// times a batch of operations sized (by doubling) to take at least
+// 'SAMPLE_TIME'. Results are printed as one JSON object per line so they can
+// be collected and diffed by scripts, e.g.:
+//
+//   {"name": "score_intro", "param": 50, "ns_per_op": 1234.5, ...}
+//
+// The first argument (if given) filters benchmarks to those whose names
+// contain it. Each result also records the simulation's 'real_t' type
+// ("float" or "fixed"; see 'SSN_FIXED_POINT') so that the 'ssn_bench' and
+// 'ssn_bench_fixed' executables can be run and compared side by side.
+
+/// Constants ///
+
+constexpr static uint32_t SAMPLE_COUNT = 30;
+constexpr static float64_t SAMPLE_TIME = 2.0e-3; // units: seconds
+constexpr static float64_t DT = 1.0 / 60.0;      // units: seconds
+constexpr static const char8_t* REAL_NAME = SSN_FIXED_POINT ? "fixed" : "float";
+
+/// Helper Types ///
+
+struct result_t {
+    float64_t mMean;   // units: nanoseconds per op
+    float64_t mStdDev; // units: nanoseconds per op
+    float64_t mMin;    // units: nanoseconds per op
+    uint64_t mBatch;   // units: ops per sample
+};
+
+/// Helper Functions ///
+
+// NOTE(JRC): 'pFinish' runs once after each batch within the timed region,
+// e.g. to wait for work that the operations queue asynchronously.
+template <typename TSetup, typename TOp, typename TFinish>
+static result_t measure( TSetup pSetup, TOp pOp, TFinish pFinish ) {
+    typedef std::chrono::steady_clock bench_clock_t;
+    const auto csTime = [] ( const bench_clock_t::time_point& pStart ) {
+        return std::chrono::duration<float64_t>( bench_clock_t::now() - pStart ).count();
+    };
+
+    uint64_t batch = 1;
+    for( float64_t batchTime = 0.0; batchTime < SAMPLE_TIME; batch *= 2 ) {
+        pSetup();
+        const bench_clock_t::time_point cStart = bench_clock_t::now();
+        for( uint64_t opIdx = 0; opIdx < batch; opIdx++ ) { pOp(); }
+        pFinish();
+        batchTime = csTime( cStart );
+    }
+
+    std::vector<float64_t> samples( SAMPLE_COUNT );
+    for( uint32_t sampleIdx = 0; sampleIdx < SAMPLE_COUNT; sampleIdx++ ) {
+        pSetup();
+        const bench_clock_t::time_point cStart = bench_clock_t::now();
+        for( uint64_t opIdx = 0; opIdx < batch; opIdx++ ) { pOp(); }
+        pFinish();
+        samples[sampleIdx] = 1.0e9 * csTime( cStart ) / batch;
+    }
+
+    result_t result;
+    result.mBatch = batch;
+    result.mMean = 0.0;
+    for( const float64_t& sample : samples ) { result.mMean += sample / SAMPLE_COUNT; }
+    result.mStdDev = 0.0;
+    for( const float64_t& sample : samples ) {
+        result.mStdDev += ( sample - result.mMean ) * ( sample - result.mMean ) / ( SAMPLE_COUNT - 1 );
+    }
+    result.mStdDev = std::sqrt( result.mStdDev );
+    result.mMin = *std::min_element( samples.begin(), samples.end() );
+    return result;
+}
+
+
+template <typename TSetup, typename TOp>
+static result_t measure( TSetup pSetup, TOp pOp ) {
+    return measure( pSetup, pOp, [] () {} );
+}
+
+
+static void report( const char8_t* pName, const int64_t pParam, const result_t& pResult ) {
+    std::printf( "{\"name\": \"%s\", \"real\": \"%s\", \"param\": %lld, \"ns_per_op\": %.3f, \"ns_stddev\": %.3f, "
+        "\"ns_min\": %.3f, \"ops_per_sec\": %.1f, \"samples\": %u, \"batch\": %llu}\n",
+        pName, REAL_NAME, static_cast<long long>(pParam), pResult.mMean, pResult.mStdDev,
+        pResult.mMin, 1.0e9 / pResult.mMean, SAMPLE_COUNT,
+        static_cast<unsigned long long>(pResult.mBatch) );
+    std::fflush( stdout );
+}
+
+
+static void skip( const char8_t* pName, const char8_t* pReason ) {
+    std::printf( "{\"name\": \"%s\", \"real\": \"%s\", \"skipped\": \"%s\"}\n",
+        pName, REAL_NAME, pReason );
+    std::fflush( stdout );
+}
+
+
+static ssn::state_t* create( const ssn::stage_e pStage, const ssn::format_e pFormat ) {
+    // NOTE(JRC): The state is allocated as a zeroed raw block to mirror how
+    // the harness allocates it.
+    ssn::state_t* state = static_cast<ssn::state_t*>(
+        std::aligned_alloc(alignof(ssn::state_t), sizeof(ssn::state_t)) );
+    std::memset( static_cast<void*>(state), 0, sizeof(ssn::state_t) );
+    state->rng = llce::rng_t( ssn::RNG_SEED );
+    state->mode = state->pmode = ssn::mode::game::ID;
+    state->sid = pStage;
+    state->fid = pFormat;
+    state->dt = DT;
+    ssn::mode::game::init( state, nullptr );
+    return state;
+}
+
+
+static void claim( ssn::state_t* pState, const uint32_t pAreaCount ) {
+    ssn::bounds_t* bounds = &pState->bounds;
+    const vec2f32_t cMin = bounds->mBBox.min(), cDims = bounds->mBBox.mDims;
+    for( uint32_t areaIdx = 0; areaIdx < pAreaCount; areaIdx++ ) {
+        for( uint32_t cornerIdx = 0; cornerIdx < ssn::bounds_t::AREA_CORNER_COUNT; cornerIdx++ ) {
+            bounds->mAreaCorners[areaIdx * ssn::bounds_t::AREA_CORNER_COUNT + cornerIdx] =
+                cMin + cDims * vec2f32_t( pState->rng.nextf(), pState->rng.nextf() );
+        }
+        bounds->mAreaTeams[areaIdx] = areaIdx % 2;
+    }
+    bounds->mAreaCount = pAreaCount;
+}
+
+
+static bool32_t enabled( const char8_t* pFilter, const char8_t* pName ) {
+    return pFilter == nullptr || std::strstr( pName, pFilter ) != nullptr;
+}
+
+/// Benchmarks ///
+
+static void benchScore( const char8_t* pFilter ) {
+    const static uint32_t csAreaCounts[] = { 0, 1, 10, 25, 50, 100 };
+
+    for( const uint32_t& areaCount : csAreaCounts ) {
+        ssn::state_t* state = create( ssn::stage::box, ssn::format::duel );
+        claim( state, areaCount );
+        ssn::mode::score::init( state, nullptr );
+
+        if( enabled(pFilter, "score_intro") ) {
+            // NOTE(JRC): Clearing 'tallied' forces the intro to re-sample the
+            // areas; the sample bits are only ever OR'd, so they needn't be reset.
+            report( "score_intro", areaCount, measure(
+                [&] () { state->st = 0.5; },
+                [&] () {
+                    ssn::scratch::get<ssn::scratch::score_t>( state )->tallied = false;
+                    ssn::mode::score::update( state, nullptr, DT );
+                }) );
+        }
+
+        if( enabled(pFilter, "score_tally") ) {
+            report( "score_tally", areaCount, measure(
+                [&] () { state->st = 1.0; },
+                [&] () {
+                    state->st = ( state->st + DT < 3.0 ) ? state->st + DT : 1.0;
+                    ssn::mode::score::update( state, nullptr, DT );
+                }) );
+        }
+
+        ssn::scratch::release( state );
+        std::free( state );
+    }
+}
+
+
+static void benchParticles( const char8_t* pFilter ) {
+    if( !enabled(pFilter, "particulator_update") ) { return; }
+
+    ssn::particulator_t particulator;
+    const auto cFill = [&] () {
+        particulator = ssn::particulator_t();
+        while( particulator.mParticles.size() < ssn::particulator_t::MAX_PARTICLE_COUNT ) {
+            particulator.genTrail( vec2f32_t(0.5f, 0.5f), vec2f32_t(1.0f, 0.0f), 5.0e-2f );
+        }
+    };
+
+    // NOTE(JRC): A tiny time step keeps every particle alive for the length
+    // of each sample, so the particulator stays at capacity throughout.
+    report( "particulator_update", ssn::particulator_t::MAX_PARTICLE_COUNT, measure(
+        cFill, [&] () { particulator.update( 1.0e-9 ); }) );
+}
+
+
+static void benchPuck( const char8_t* pFilter ) {
+    ssn::state_t* state = create( ssn::stage::box, ssn::format::duel );
+    ssn::puck_t* puck = &state->pucks[0];
+    ssn::paddle_t* paddle = &state->paddles[0];
+
+    // NOTE(JRC): The puck is sent diagonally so that it wraps on both axes
+    // regularly, and the paddle sits on its path to exercise the hit sweep.
+    const auto cReset = [&] () {
+        puck->pos() = ssn::real::tor( vec2f32_t(0.25f, 0.25f) );
+        puck->vel() = ssn::real::tor( vec2f32_t(ssn::puck_t::MAX_VEL, 0.9f * ssn::puck_t::MAX_VEL) );
+        paddle->pos() = ssn::real::tor( vec2f32_t(0.75f, 0.70f) );
+        paddle->vel() = ssn::vec2r_t( ssn::real_t(0), ssn::real_t(0) );
+    };
+
+    if( enabled(pFilter, "puck_resolve") ) {
+        report( "puck_resolve", 1, measure( cReset, [&] () {
+            puck->pos() += ssn::real::tor( DT ) * puck->vel();
+            puck->resolve( DT );
+        }) );
+    }
+
+    if( enabled(pFilter, "puck_hit") ) {
+        report( "puck_hit", 1, measure( cReset, [&] () {
+            puck->pos() += ssn::real::tor( DT ) * puck->vel();
+            puck->resolve( DT );
+            puck->hit( paddle, DT );
+        }) );
+    }
+
+    std::free( state );
+}
+
+
+static void benchPaddle( const char8_t* pFilter ) {
+    if( !enabled(pFilter, "paddle_update") ) { return; }
+
+    ssn::state_t* state = create( ssn::stage::box, ssn::format::duel );
+    ssn::paddle_t* paddle = &state->paddles[0];
+
+    uint32_t tickIdx = 0;
+    report( "paddle_update", 1, measure(
+        [&] () { tickIdx = 0; },
+        [&] () {
+            // NOTE(JRC): The input direction spins and a rush is requested
+            // every tick, so every branch of the update is exercised.
+            const int32_t cDirX = static_cast<int32_t>( tickIdx % 3 ) - 1;
+            const int32_t cDirY = static_cast<int32_t>( (tickIdx / 3) % 3 ) - 1;
+            paddle->move( cDirX, cDirY );
+            paddle->rush();
+            paddle->update( DT );
+            paddle->pos() += ssn::real::tor( DT ) * paddle->vel();
+            paddle->resolve( DT );
+            tickIdx++;
+        }) );
+
+    std::free( state );
+}
+
+
+static void benchState( const char8_t* pFilter ) {
+    if( !enabled(pFilter, "state_footprint") && !enabled(pFilter, "game_step") ) { return; }
+
+    constexpr static uint32_t csLineBytes = ssn::STATE_CACHE_LINE_BYTES;
+    constexpr static uint32_t csLineCount = ( sizeof(ssn::state_t) + csLineBytes - 1 ) / csLineBytes;
+    constexpr static uint32_t csTickCount = 60 * 60;
+
+    // NOTE(JRC): Inputs cycle through all move directions with periodic rushes
+    // so that paddles cover the stage and pucks are hit, wrapped and claimed.
+    const auto cActions = [] ( const uint32_t pTickIdx ) {
+        ssn::actions_t actions = { 0, 0 };
+        const uint32_t cPhase = ( pTickIdx / 30 ) % 4;
+        const uint32_t cMoves[2][4] = {
+            { ssn::action::lup, ssn::action::lright, ssn::action::ldown, ssn::action::lleft },
+            { ssn::action::rdown, ssn::action::rleft, ssn::action::rup, ssn::action::rright } };
+        actions.down = static_cast<uint16_t>( (1 << cMoves[0][cPhase]) | (1 << cMoves[1][cPhase]) );
+        actions.pressed = static_cast<uint16_t>( (pTickIdx % 45 == 0) ?
+            (1 << ssn::action::lrush) | (1 << ssn::action::rrush) : 0 );
+        return actions;
+    };
+
+    for( uint32_t format = 0; format < ssn::format::_length; format++ ) {
+        ssn::state_t* state = create( ssn::stage::box, static_cast<ssn::format_e>(format) );
+
+        if( enabled(pFilter, "state_footprint") ) {
+            // NOTE(JRC): The footprint is measured as the set of state cache lines
+            // that differ across each tick (i.e. were written), which bounds the
+            // lines that must be resident to run the simulation step; 'lines_hot'
+            // counts the lines that are written on most ticks.
+            std::vector<bit8_t> prevState( sizeof(ssn::state_t) );
+            std::vector<uint32_t> lineTicks( csLineCount, 0 );
+            const bit8_t* cState = reinterpret_cast<const bit8_t*>( state );
+            for( uint32_t tickIdx = 0; tickIdx < csTickCount && state->pmode == ssn::mode::game::ID; tickIdx++ ) {
+                std::memcpy( prevState.data(), cState, sizeof(ssn::state_t) );
+                ssn::mode::game::step( state, cActions(tickIdx), DT );
+                for( uint32_t lineIdx = 0; lineIdx < csLineCount; lineIdx++ ) {
+                    const uint32_t cLineOffset = lineIdx * csLineBytes;
+                    const uint32_t cLineBytes = std::min<uint32_t>(
+                        csLineBytes, sizeof(ssn::state_t) - cLineOffset );
+                    lineTicks[lineIdx] += std::memcmp( &prevState[cLineOffset],
+                        cState + cLineOffset, cLineBytes ) != 0;
+                }
+            }
+
+            uint32_t linesWritten = 0, linesHot = 0;
+            for( uint32_t lineIdx = 0; lineIdx < csLineCount; lineIdx++ ) {
+                linesWritten += lineTicks[lineIdx] > 0;
+                linesHot += lineTicks[lineIdx] > csTickCount / 2;
+            }
+
+            const bit8_t* cHotEnd = reinterpret_cast<const bit8_t*>( &state->paddleCount + 1 );
+            std::printf( "{\"name\": \"state_footprint\", \"real\": \"%s\", \"param\": %u, \"state_bytes\": %u, "
+                "\"state_lines\": %u, \"hot_bytes\": %u, \"lines_written\": %u, "
+                "\"lines_hot\": %u, \"ticks\": %u}\n",
+                REAL_NAME, format, static_cast<uint32_t>(sizeof(ssn::state_t)), csLineCount,
+                static_cast<uint32_t>(cHotEnd - cState), linesWritten, linesHot, csTickCount );
+            std::fflush( stdout );
+        }
+
+        if( enabled(pFilter, "game_step") ) {
+            ssn::mode::game::init( state, nullptr );
+            uint32_t tickIdx = 0;
+            report( "game_step", format, measure(
+                [&] () { tickIdx = 0; },
+                [&] () {
+                    // NOTE(JRC): Rounds are restarted before they end so that every
+                    // measured tick runs the full simulation step.
+                    if( state->rt + DT >= ssn::ROUND_DURATION ) { ssn::mode::game::init( state, nullptr ); }
+                    ssn::mode::game::step( state, cActions(tickIdx++), DT );
+                }) );
+        }
+
+        std::free( state );
+    }
+}
+
+
+static void benchRender( const char8_t* pFilter ) {
+    if( !enabled(pFilter, "gameboard_render") ) { return; }
+
+    // NOTE(JRC): Rendering uses a hidden window's context so that the
+    // benchmark can run without a visible display surface; if even that isn't
+    // available (e.g. no display server), the benchmark is skipped.
+    if( SDL_Init(SDL_INIT_VIDEO) != 0 ) {
+        skip( "gameboard_render", "no video subsystem" );
+        return;
+    }
+    SDL_Window* window = SDL_CreateWindow( "ssn_bench", SDL_WINDOWPOS_UNDEFINED,
+        SDL_WINDOWPOS_UNDEFINED, 512, 512, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN );
+    SDL_GLContext context = ( window != nullptr ) ? SDL_GL_CreateContext( window ) : nullptr;
+    if( context == nullptr ) {
+        skip( "gameboard_render", "no OpenGL context" );
+        if( window != nullptr ) { SDL_DestroyWindow( window ); }
+        SDL_Quit();
+        return;
+    }
+
+    const static uint32_t csAreaCounts[] = { 0, 50, 100 };
+    for( const uint32_t& areaCount : csAreaCounts ) {
+        ssn::state_t* state = create( ssn::stage::box, ssn::format::duel );
+        claim( state, areaCount );
+        state->particulator.genTrail( vec2f32_t(0.5f, 0.5f), vec2f32_t(1.0f, 0.0f), 5.0e-2f );
+
+        // NOTE(JRC): The pipeline is drained before each sample starts and
+        // finished before its clock stops, so deferred driver/GPU work is
+        // attributed to the frames that queued it.
+        report( "gameboard_render", areaCount, measure(
+            [&] () { glFinish(); },
+            [&] () {
+                glClear( GL_COLOR_BUFFER_BIT );
+                ssn::mode::game::render( state, nullptr, nullptr );
+            },
+            [&] () { glFinish(); }) );
+
+        std::free( state );
+    }
+
+    SDL_GL_DeleteContext( context );
+    SDL_DestroyWindow( window );
+    SDL_Quit();
+}
+
+/// Main ///
+
+int main( int pArgCount, char* pArgs[] ) {
+    const char8_t* cFilter = ( pArgCount > 1 ) ? pArgs[1] : nullptr;
+
+    benchScore( cFilter );
+    benchParticles( cFilter );
+    benchPuck( cFilter );
+    benchPaddle( cFilter );
+    benchState( cFilter );
+    benchRender( cFilter );
+
+    return 0;
+}
@@ -0,0 +1,344 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_opengl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rng_t.h"
+
+#include "ssn_archive_t.h"
+#include "ssn_replay_t.h"
+#include "ssn_modes.h"
+#include "ssn_scratch.h"
+#include "ssn.h"
+
+// NOTE(JRC): Replays a corpus of recorded sessions (replay files and/or
+// replay archives) through the per-frame mode functions, timing each frame
+// from the start of the round through the end of the score sequence, and
+// reports frame time statistics per mode as one JSON object per line:
+//
+//   {"mode": "score", "frames": 240, "mean_us": ..., "p50_us": ..., ...}
+//
+// Usage: ssn_frames [--baseline <path>] [--save <path>] [--threshold <ratio>]
+//                   [--passes <count>] <corpus...>
+//
+// The corpus is replayed for several passes; the mean, p50 and max are taken
+// over the frames of all passes, while the p99 is the median of the per-pass
+// p99s (with the lowest and highest recorded as its spread), since a single
+// p99 swings by more than any useful threshold between identical runs.
+//
+// Given a baseline (the saved output of a previous run), a mode is flagged as
+// a regression if its mean frame time grew by more than the threshold and the
+// growth is significant (Welch's t-test), or if its p99 grew by more than the
+// threshold and its spread lies entirely above the baseline's spread; any
+// regression makes the harness exit with a status of 1.
+
+/// Constants ///
+
+constexpr static float64_t T_CRITICAL = 2.576; // units: two-sided z for p < 0.01 (large samples)
+constexpr static float64_t DEFAULT_THRESHOLD = 0.05; // units: relative growth
+constexpr static uint32_t DEFAULT_PASS_COUNT = 5;
+
+/// Helper Types ///
+
+typedef bool32_t (*init_f)( ssn::state_t*, ssn::input_t* );
+typedef bool32_t (*update_f)( ssn::state_t*, ssn::input_t*, const float64_t );
+typedef bool32_t (*render_f)( const ssn::state_t*, const ssn::input_t*, const ssn::output_t* );
+
+struct mode_entry_t {
+    const char8_t* mName;
+    ssn::mode_e mID;
+    init_f mInit;
+    update_f mUpdate;
+    render_f mRender;
+};
+
+struct stats_t {
+    char8_t mName[32];
+    uint64_t mFrames;
+    float64_t mMean, mStdDev; // units: microseconds
+    float64_t mP50, mP99, mMax; // units: microseconds
+    float64_t mP99Lo, mP99Hi;   // units: microseconds (lowest/highest per-pass p99)
+    uint32_t mPasses;
+};
+
+/// Helper Variables ///
+
+// NOTE(JRC): Only the modes a recorded round passes through (without menu
+// input) are replayed; the run of a session ends once it leaves these modes.
+const static mode_entry_t MODES[] = {
+    { "game", ssn::mode::game::ID, ssn::mode::game::init, ssn::mode::game::update, ssn::mode::game::render },
+    { "score", ssn::mode::score::ID, ssn::mode::score::init, ssn::mode::score::update, ssn::mode::score::render },
+};
+constexpr static uint32_t MODE_COUNT = LLCE_ELEM_COUNT( MODES );
+
+/// Helper Functions ///
+
+static const mode_entry_t* lookup( const ssn::mode_e pID ) {
+    for( uint32_t modeIdx = 0; modeIdx < MODE_COUNT; modeIdx++ ) {
+        if( MODES[modeIdx].mID == pID ) { return &MODES[modeIdx]; }
+    }
+    return nullptr;
+}
+
+
+static void play( const ssn::replay_t::header_t& pHeader, const bit8_t* pStream,
+        const bool32_t pRender, std::vector<float64_t> pTimes[MODE_COUNT] ) {
+    typedef std::chrono::steady_clock frame_clock_t;
+
+    ssn::state_t* state = static_cast<ssn::state_t*>(
+        std::aligned_alloc(alignof(ssn::state_t), sizeof(ssn::state_t)) );
+    std::memset( static_cast<void*>(state), 0, sizeof(ssn::state_t) );
+    ssn::replay_player_t player( pHeader, pStream, state );
+
+    // NOTE(JRC): Recorded ticks go through the replay player (which calls the
+    // same 'game::step' as 'game::update'); once the recording runs out, the
+    // remaining frames are driven by the mode functions as in 'update'.
+    for( const mode_entry_t* mode = lookup( state->mode ); mode != nullptr; mode = lookup(state->mode) ) {
+        const frame_clock_t::time_point cStart = frame_clock_t::now();
+
+        if( state->mode != state->pmode ) {
+            const mode_entry_t* cNextMode = lookup( state->pmode );
+            if( cNextMode == nullptr ) { break; }
+            ssn::scratch::release( state );
+            cNextMode->mInit( state, nullptr );
+            state->mode = state->pmode;
+            state->st = 0.0;
+            mode = cNextMode;
+        }
+
+        if( state->mode == ssn::mode::game::ID && !player.done() ) {
+            if( !player.step() ) { break; }
+        } else if( state->mode == ssn::mode::game::ID ) {
+            ssn::mode::game::step( state, ssn::actions_t{0, 0}, pHeader.mDT );
+            state->tt += pHeader.mDT;
+            state->st += pHeader.mDT;
+        } else {
+            state->dt = pHeader.mDT;
+            state->tt += pHeader.mDT;
+            state->st += pHeader.mDT;
+            mode->mUpdate( state, nullptr, pHeader.mDT );
+        }
+
+        if( pRender ) {
+            glClear( GL_COLOR_BUFFER_BIT );
+            mode->mRender( state, nullptr, nullptr );
+            glFinish();
+        }
+
+        pTimes[mode - &MODES[0]].push_back( 1.0e6 *
+            std::chrono::duration<float64_t>(frame_clock_t::now() - cStart).count() );
+    }
+
+    ssn::scratch::release( state );
+    std::free( state );
+}
+
+
+static float64_t percentile( std::vector<float64_t>& pTimes, const float64_t pRatio ) {
+    std::sort( pTimes.begin(), pTimes.end() );
+    return pTimes[static_cast<size_t>( pRatio * (pTimes.size() - 1) + 0.5 )];
+}
+
+
+static stats_t summarize( const char8_t* pName, std::vector< std::vector<float64_t> >& pPassTimes ) {
+    stats_t stats;
+    std::memset( &stats, 0, sizeof(stats) );
+    std::strncpy( stats.mName, pName, sizeof(stats.mName) - 1 );
+
+    std::vector<float64_t> times, passP99s;
+    for( std::vector<float64_t>& passTimes : pPassTimes ) {
+        if( passTimes.empty() ) { continue; }
+        times.insert( times.end(), passTimes.begin(), passTimes.end() );
+        passP99s.push_back( percentile(passTimes, 0.99) );
+    }
+    stats.mFrames = times.size();
+    stats.mPasses = static_cast<uint32_t>( passP99s.size() );
+    if( times.empty() ) {
+        return stats;
+    }
+
+    for( const float64_t& time : times ) { stats.mMean += time / times.size(); }
+    for( const float64_t& time : times ) {
+        stats.mStdDev += ( time - stats.mMean ) * ( time - stats.mMean ) /
+            std::max<float64_t>( times.size() - 1.0, 1.0 );
+    }
+    stats.mStdDev = std::sqrt( stats.mStdDev );
+    stats.mP50 = percentile( times, 0.50 );
+    stats.mMax = times.back();
+    stats.mP99 = percentile( passP99s, 0.50 );
+    stats.mP99Lo = passP99s.front();
+    stats.mP99Hi = passP99s.back();
+    return stats;
+}
+
+
+static void write_stats( std::FILE* pFile, const stats_t& pStats ) {
+    std::fprintf( pFile, "{\"mode\": \"%s\", \"frames\": %llu, \"mean_us\": %.3f, \"stddev_us\": %.3f, "
+        "\"p50_us\": %.3f, \"p99_us\": %.3f, \"max_us\": %.3f, \"passes\": %u, "
+        "\"p99_lo_us\": %.3f, \"p99_hi_us\": %.3f}\n",
+        pStats.mName, static_cast<unsigned long long>(pStats.mFrames), pStats.mMean,
+        pStats.mStdDev, pStats.mP50, pStats.mP99, pStats.mMax, pStats.mPasses,
+        pStats.mP99Lo, pStats.mP99Hi );
+}
+
+
+static bool32_t read_stats( std::FILE* pFile, stats_t* pStats ) {
+    unsigned long long frames = 0;
+    std::memset( pStats, 0, sizeof(*pStats) );
+    const int32_t cFieldCount = std::fscanf( pFile, " {\"mode\": \"%31[^\"]\", \"frames\": %llu, "
+        "\"mean_us\": %lf, \"stddev_us\": %lf, \"p50_us\": %lf, \"p99_us\": %lf, \"max_us\": %lf, "
+        "\"passes\": %u, \"p99_lo_us\": %lf, \"p99_hi_us\": %lf}",
+        pStats->mName, &frames, &pStats->mMean, &pStats->mStdDev,
+        &pStats->mP50, &pStats->mP99, &pStats->mMax, &pStats->mPasses,
+        &pStats->mP99Lo, &pStats->mP99Hi );
+    pStats->mFrames = frames;
+    return cFieldCount == 10;
+}
+
+
+static bool32_t regressed( const stats_t& pBase, const stats_t& pCurr, const float64_t pThreshold ) {
+    const float64_t cBaseVar = pBase.mStdDev * pBase.mStdDev / std::max<uint64_t>( pBase.mFrames, 1 );
+    const float64_t cCurrVar = pCurr.mStdDev * pCurr.mStdDev / std::max<uint64_t>( pCurr.mFrames, 1 );
+    const float64_t cWelchT = ( pCurr.mMean - pBase.mMean ) /
+        std::max( std::sqrt(cBaseVar + cCurrVar), 1.0e-12 );
+
+    const bool32_t cMeanRegressed = pCurr.mMean > pBase.mMean * ( 1.0 + pThreshold ) && cWelchT > T_CRITICAL;
+    // NOTE(JRC): The p99 only counts as regressed when every pass of the
+    // current run had a worse p99 than every pass of the baseline, so run to
+    // run noise (which widens both spreads) can't trip it on its own.
+    const bool32_t cTailRegressed = pCurr.mP99 > pBase.mP99 * ( 1.0 + pThreshold ) &&
+        pCurr.mP99Lo > pBase.mP99Hi;
+
+    std::fprintf( stderr, "%-8s mean %9.3fus -> %9.3fus (%+6.1f%%, t=%6.2f)  "
+        "p99 %9.3fus [%.3f, %.3f] -> %9.3fus [%.3f, %.3f] (%+6.1f%%)%s\n",
+        pCurr.mName, pBase.mMean, pCurr.mMean, 100.0 * (pCurr.mMean / pBase.mMean - 1.0), cWelchT,
+        pBase.mP99, pBase.mP99Lo, pBase.mP99Hi, pCurr.mP99, pCurr.mP99Lo, pCurr.mP99Hi,
+        100.0 * (pCurr.mP99 / pBase.mP99 - 1.0), ( cMeanRegressed || cTailRegressed ) ? "  REGRESSION" : "" );
+    return cMeanRegressed || cTailRegressed;
+}
+
+/// Main ///
+
+int main( int pArgCount, char* pArgs[] ) {
+    const char8_t* baselinePath = nullptr;
+    const char8_t* savePath = nullptr;
+    float64_t threshold = DEFAULT_THRESHOLD;
+    uint32_t passCount = DEFAULT_PASS_COUNT;
+    std::vector<const char8_t*> corpusPaths;
+
+    for( int32_t argIdx = 1; argIdx < pArgCount; argIdx++ ) {
+        const std::string cArg( pArgs[argIdx] );
+        if( cArg == "--baseline" && argIdx + 1 < pArgCount ) {
+            baselinePath = pArgs[++argIdx];
+        } else if( cArg == "--save" && argIdx + 1 < pArgCount ) {
+            savePath = pArgs[++argIdx];
+        } else if( cArg == "--threshold" && argIdx + 1 < pArgCount ) {
+            threshold = std::atof( pArgs[++argIdx] );
+        } else if( cArg == "--passes" && argIdx + 1 < pArgCount ) {
+            passCount = static_cast<uint32_t>( std::max(std::atoi(pArgs[++argIdx]), 1) );
+        } else {
+            corpusPaths.push_back( pArgs[argIdx] );
+        }
+    }
+
+    if( corpusPaths.empty() ) {
+        std::fprintf( stderr, "usage: %s [--baseline <path>] [--save <path>] "
+            "[--threshold <ratio>] [--passes <count>] <replay-or-archive...>\n", pArgs[0] );
+        return 2;
+    }
+
+    // NOTE(JRC): Without a context (e.g. no display server), frames are timed
+    // without rendering and the results shouldn't be compared to a baseline
+    // with rendering.
+    SDL_Window* window = nullptr;
+    SDL_GLContext context = nullptr;
+    if( SDL_Init(SDL_INIT_VIDEO) == 0 ) {
+        window = SDL_CreateWindow( "ssn_frames", SDL_WINDOWPOS_UNDEFINED,
+            SDL_WINDOWPOS_UNDEFINED, 512, 512, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN );
+        context = ( window != nullptr ) ? SDL_GL_CreateContext( window ) : nullptr;
+    }
+    const bool32_t cRender = context != nullptr;
+    if( !cRender ) {
+        std::fprintf( stderr, "warning: no OpenGL context available; timing updates only\n" );
+    }
+
+    std::vector< std::vector<float64_t> > modeTimes[MODE_COUNT];
+    for( uint32_t passIdx = 0; passIdx < passCount; passIdx++ ) {
+        std::vector<float64_t> passTimes[MODE_COUNT];
+        for( const char8_t* corpusPath : corpusPaths ) {
+            ssn::archive_t archive;
+            ssn::replay_t replay( llce::rng_t(0), 0.0, ssn::stage::box, ssn::format::duel );
+
+            std::FILE* corpusFile = std::fopen( corpusPath, "rb" );
+            uint32_t corpusMagic = 0;
+            if( corpusFile != nullptr ) {
+                // NOTE(JRC): Archives are identified by their trailer and replays
+                // by their header, both of which lead with their magic number.
+                const bool32_t cIsReplay = std::fread( &corpusMagic, sizeof(corpusMagic), 1, corpusFile ) == 1 &&
+                    corpusMagic == ssn::replay_t::MAGIC;
+                std::fclose( corpusFile );
+                corpusMagic = cIsReplay ? ssn::replay_t::MAGIC : ssn::archive_t::MAGIC;
+            }
+
+            if( corpusMagic == ssn::replay_t::MAGIC && ssn::replay_t::load(corpusPath, &replay) ) {
+                play( replay.mHeader, replay.mStream.data(), cRender, passTimes );
+            } else if( corpusMagic == ssn::archive_t::MAGIC && archive.open(corpusPath) ) {
+                for( uint64_t entryIdx = 0; entryIdx < archive.count(); entryIdx++ ) {
+                    play( *archive.header(entryIdx), archive.stream(entryIdx), cRender, passTimes );
+                }
+            } else {
+                std::fprintf( stderr, "warning: skipping unreadable corpus file '%s'\n", corpusPath );
+            }
+        }
+
+        for( uint32_t modeIdx = 0; modeIdx < MODE_COUNT; modeIdx++ ) {
+            modeTimes[modeIdx].push_back( std::move(passTimes[modeIdx]) );
+        }
+    }
+
+    if( context != nullptr ) { SDL_GL_DeleteContext( context ); }
+    if( window != nullptr ) { SDL_DestroyWindow( window ); }
+    SDL_Quit();
+
+    stats_t modeStats[MODE_COUNT];
+    std::FILE* saveFile = ( savePath != nullptr ) ? std::fopen( savePath, "w" ) : nullptr;
+    for( uint32_t modeIdx = 0; modeIdx < MODE_COUNT; modeIdx++ ) {
+        modeStats[modeIdx] = summarize( MODES[modeIdx].mName, modeTimes[modeIdx] );
+        write_stats( stdout, modeStats[modeIdx] );
+        if( saveFile != nullptr ) { write_stats( saveFile, modeStats[modeIdx] ); }
+    }
+    if( saveFile != nullptr ) { std::fclose( saveFile ); }
+
+    bool32_t hasRegression = false;
+    std::FILE* baselineFile = ( baselinePath != nullptr ) ? std::fopen( baselinePath, "r" ) : nullptr;
+    if( baselinePath != nullptr && baselineFile == nullptr ) {
+        std::fprintf( stderr, "warning: couldn't open baseline '%s'\n", baselinePath );
+    } else if( baselineFile != nullptr ) {
+        stats_t baseStats;
+        uint32_t baseCount = 0;
+        for( ; read_stats(baselineFile, &baseStats); baseCount++ ) {
+            for( uint32_t modeIdx = 0; modeIdx < MODE_COUNT; modeIdx++ ) {
+                if( std::strcmp(baseStats.mName, modeStats[modeIdx].mName) == 0 &&
+                        baseStats.mFrames > 0 && modeStats[modeIdx].mFrames > 0 ) {
+                    hasRegression |= regressed( baseStats, modeStats[modeIdx], threshold );
+                }
+            }
+        }
+        std::fclose( baselineFile );
+
+        if( baseCount == 0 ) {
+            std::fprintf( stderr, "warning: no results read from baseline '%s' "
+                "(baselines saved without per-pass p99s need to be saved again)\n", baselinePath );
+        }
+    }
+
+    return hasRegression ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "rng_t.h"
+
+#include "ssn_rollback_t.h"
+#include "ssn_transport_t.h"
+#include "ssn_modes.h"
+#include "ssn_data.h"
+#include "ssn.h"
+
+// NOTE(JRC): Plays a scripted round between two 'ssn::rollback_t' peers (one
+// per team) connected through a pair of 'ssn::lag_transport_t' channels, and
+// checks that both peers converge on the same state as a reference simulation
+// that's given every input on time. Each link profile is run over an in-memory
+// channel (fully reproducible) and over a loopback 'ssn::udp_transport_t'
+// pair, and results are printed as one JSON object per peer per line:
+//
+//   {"name": "rollback", "transport": "memory", "latency_ms": 50, ..., "converged": true}
+//
+// Any peer that fails to converge makes the harness exit with a status of 1.
+
+/// Constants ///
+
+constexpr static float64_t DT = 1.0 / 60.0;    // units: seconds
+constexpr static uint32_t TICK_COUNT = 1800;    // units: ticks (well short of a round)
+constexpr static uint32_t SETTLE_COUNT = 600;   // units: frames allowed to settle after the last tick
+constexpr static uint16_t UDP_PORT = 47100;     // units: base port for loopback peers
+constexpr static const char8_t* REAL_NAME = SSN_FIXED_POINT ? "fixed" : "float";
+
+/// Helper Types ///
+
+struct link_t {
+    float64_t mLatency; // units: seconds (one way)
+    float64_t mJitter;  // units: seconds
+    float32_t mLoss;    // units: probability in [0, 1]
+};
+
+// NOTE(JRC): A lossless, ordered datagram channel between two transports in
+// the same process; all of the link's misbehavior comes from the
+// 'lag_transport_t' layered on top of it.
+class memory_transport_t : public ssn::transport_t {
+    public:
+
+    typedef std::deque< std::vector<bit8_t> > queue_t;
+
+    memory_transport_t( queue_t* pOutbox, queue_t* pInbox ) :
+        mOutbox( pOutbox ), mInbox( pInbox ) {}
+
+    bool32_t send( const bit8_t* pData, const uint32_t pBytes ) override {
+        mOutbox->emplace_back( pData, pData + pBytes );
+        return true;
+    }
+
+    uint32_t recv( bit8_t* pData, const uint32_t pMaxBytes ) override {
+        if( mInbox->empty() ) { return 0; }
+        const std::vector<bit8_t>& cDatagram = mInbox->front();
+        const uint32_t cBytes = std::min( static_cast<uint32_t>(cDatagram.size()), pMaxBytes );
+        std::memcpy( pData, cDatagram.data(), cBytes );
+        mInbox->pop_front();
+        return cBytes;
+    }
+
+    private:
+
+    queue_t* mOutbox;
+    queue_t* mInbox;
+};
+
+/// Helper Variables ///
+
+const static link_t LINKS[] = {
+    { 0.000, 0.000, 0.00f },
+    { 0.030, 0.005, 0.00f },
+    { 0.060, 0.020, 0.02f },
+    { 0.120, 0.040, 0.10f },
+    { 0.250, 0.050, 0.25f },
+};
+
+/// Helper Functions ///
+
+static ssn::state_t* create() {
+    ssn::state_t* state = static_cast<ssn::state_t*>(
+        std::aligned_alloc(alignof(ssn::state_t), sizeof(ssn::state_t)) );
+    std::memset( static_cast<void*>(state), 0, sizeof(ssn::state_t) );
+    state->rng = llce::rng_t( ssn::RNG_SEED );
+    state->mode = state->pmode = ssn::mode::game::ID;
+    state->sid = ssn::stage::box;
+    state->fid = ssn::format::duel;
+    state->dt = DT;
+    ssn::mode::game::init( state, nullptr );
+    return state;
+}
+
+
+// NOTE(JRC): Each team holds a random set of directions for a random stretch
+// of ticks and occasionally rushes, which gives the remote predictor (held
+// directions persist, presses don't) a realistic mix of hits and misses.
+static std::vector<ssn::actions_t> script( const ssn::team_e pTeam ) {
+    const uint32_t cFirstAction = ( pTeam == ssn::team::left ) ? ssn::action::lup : ssn::action::rup;
+    llce::rng_t rng( ssn::RNG_SEED + 1 + pTeam );
+
+    std::vector<ssn::actions_t> actions( TICK_COUNT );
+    uint16_t held = 0;
+    for( uint32_t tickIdx = 0; tickIdx < TICK_COUNT; tickIdx++ ) {
+        if( rng.nextf() < 1.0 / 20.0 ) {
+            held = 0;
+            for( uint32_t dirIdx = 0; dirIdx < 4; dirIdx++ ) {
+                held |= ( rng.nextf() < 0.3 ) ? static_cast<uint16_t>( 1 << (cFirstAction + dirIdx) ) : 0;
+            }
+        }
+        const uint16_t cRush = ( rng.nextf() < 1.0 / 60.0 ) ?
+            static_cast<uint16_t>( 1 << (cFirstAction + 4) ) : 0;
+        actions[tickIdx] = { static_cast<uint16_t>(held | cRush), cRush };
+    }
+    return actions;
+}
+
+
+static bool32_t play( const char8_t* pName, ssn::transport_t* pBases[2], const link_t& pLink,
+        const std::vector<ssn::actions_t> pScripts[2], const ssn::state_t* pReference ) {
+    ssn::state_t* states[2] = { create(), create() };
+    ssn::lag_transport_t lags[2] = {
+        ssn::lag_transport_t( pBases[0], pLink.mLatency, pLink.mJitter, pLink.mLoss, llce::rng_t(ssn::RNG_SEED + 3) ),
+        ssn::lag_transport_t( pBases[1], pLink.mLatency, pLink.mJitter, pLink.mLoss, llce::rng_t(ssn::RNG_SEED + 4) ) };
+    ssn::rollback_t* peers[2] = {
+        new ssn::rollback_t( states[0], &lags[0], ssn::team::left, DT ),
+        new ssn::rollback_t( states[1], &lags[1], ssn::team::right, DT ) };
+
+    // NOTE(JRC): Each frame advances the link clocks by one tick's worth of
+    // time and gives each peer one chance to simulate; a stalled peer retries
+    // the same scripted tick on the next frame. Once both peers have simulated
+    // every tick, they keep flushing until all remote input has arrived.
+    uint32_t settleFrames = 0;
+    for( bool32_t settled = false; !settled && settleFrames < SETTLE_COUNT; ) {
+        settled = true;
+        for( uint32_t peerIdx = 0; peerIdx < 2; peerIdx++ ) {
+            lags[peerIdx].update( DT );
+        } for( uint32_t peerIdx = 0; peerIdx < 2; peerIdx++ ) {
+            ssn::rollback_t* peer = peers[peerIdx];
+            if( peer->tick() < TICK_COUNT ) {
+                peer->advance( pScripts[peerIdx][peer->tick()] );
+                settled = false;
+            } else {
+                settled = peer->flush() && settled;
+            }
+        }
+
+        if( peers[0]->tick() >= TICK_COUNT && peers[1]->tick() >= TICK_COUNT ) {
+            settleFrames++;
+        }
+    }
+
+    bool32_t converged = true;
+    for( uint32_t peerIdx = 0; peerIdx < 2; peerIdx++ ) {
+        const ssn::rollback_t::stats_t& cStats = peers[peerIdx]->mStats;
+        const bool32_t cPeerConverged = peers[peerIdx]->confirmed() == TICK_COUNT &&
+            std::memcmp( states[peerIdx], pReference, sizeof(ssn::state_t) ) == 0;
+        std::printf( "{\"name\": \"rollback\", \"real\": \"%s\", \"transport\": \"%s\", \"latency_ms\": %.0f, "
+            "\"jitter_ms\": %.0f, \"loss\": %.2f, \"team\": %u, \"ticks\": %u, \"settle_frames\": %u, "
+            "\"rollbacks\": %llu, \"resim_ticks\": %llu, \"max_depth\": %u, \"max_resim_us\": %.3f, "
+            "\"stalls\": %llu, \"converged\": %s}\n",
+            REAL_NAME, pName, 1.0e3 * pLink.mLatency, 1.0e3 * pLink.mJitter, pLink.mLoss, peerIdx,
+            peers[peerIdx]->confirmed(), settleFrames,
+            static_cast<unsigned long long>(cStats.mRollbackCount),
+            static_cast<unsigned long long>(cStats.mResimTicks), cStats.mMaxDepth,
+            1.0e6 * cStats.mMaxResimTime, static_cast<unsigned long long>(cStats.mStallCount),
+            cPeerConverged ? "true" : "false" );
+        std::fflush( stdout );
+        converged = converged && cPeerConverged;
+    }
+
+    for( uint32_t peerIdx = 0; peerIdx < 2; peerIdx++ ) {
+        delete peers[peerIdx];
+        std::free( states[peerIdx] );
+    }
+    return converged;
+}
+
+/// Main ///
+
+int main() {
+    const std::vector<ssn::actions_t> cScripts[2] = { script(ssn::team::left), script(ssn::team::right) };
+
+    ssn::state_t* reference = create();
+    for( uint32_t tickIdx = 0; tickIdx < TICK_COUNT; tickIdx++ ) {
+        const ssn::actions_t cActions = {
+            static_cast<uint16_t>( cScripts[0][tickIdx].down | cScripts[1][tickIdx].down ),
+            static_cast<uint16_t>( cScripts[0][tickIdx].pressed | cScripts[1][tickIdx].pressed ) };
+        ssn::mode::game::step( reference, cActions, DT );
+        reference->tt += DT;
+        reference->st += DT;
+    }
+
+    bool32_t converged = true;
+    for( uint32_t linkIdx = 0; linkIdx < LLCE_ELEM_COUNT(LINKS); linkIdx++ ) {
+        memory_transport_t::queue_t queues[2];
+        memory_transport_t memories[2] = {
+            memory_transport_t( &queues[0], &queues[1] ),
+            memory_transport_t( &queues[1], &queues[0] ) };
+        ssn::transport_t* memoryBases[2] = { &memories[0], &memories[1] };
+        converged = play( "memory", memoryBases, LINKS[linkIdx], cScripts, reference ) && converged;
+
+        ssn::udp_transport_t udps[2];
+        const uint16_t cPort = static_cast<uint16_t>( UDP_PORT + 2 * linkIdx );
+        if( udps[0].open(cPort, "127.0.0.1", cPort + 1) && udps[1].open(cPort + 1, "127.0.0.1", cPort) ) {
+            ssn::transport_t* udpBases[2] = { &udps[0], &udps[1] };
+            converged = play( "udp", udpBases, LINKS[linkIdx], cScripts, reference ) && converged;
+        } else {
+            std::printf( "{\"name\": \"rollback\", \"real\": \"%s\", \"transport\": \"udp\", "
+                "\"skipped\": \"couldn't open loopback sockets\"}\n", REAL_NAME );
+        }
+    }
+
+    std::free( reference );
+    return converged ? 0 : 1;
+}
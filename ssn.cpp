@@ -5,6 +5,7 @@
 #include <glm/common.hpp>
 
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
 
 #include "gfx.h"
@@ -13,6 +14,11 @@
 #include "output.h"
 
 #include "ssn_modes.h"
+#include "ssn_scratch.h"
+#include "ssn_telemetry.h"
+#include "ssn_latency.h"
+#include "ssn_mixer.h"
+#include "ssn_recorder.h"
 #include "ssn_consts.h"
 #include "ssn.h"
 
@@ -33,8 +39,38 @@ constexpr static update_f MODE_UPDATE_FUNS[] = {
     ssn::mode::game::update, ssn::mode::select::update, ssn::mode::title::update, ssn::mode::score::update, ssn::mode::reset::update, ssn::mode::bind::update };
 constexpr static render_f MODE_RENDER_FUNS[] = {
     ssn::mode::game::render, ssn::mode::select::render, ssn::mode::title::render, ssn::mode::score::render, ssn::mode::reset::render, ssn::mode::bind::render };
+// NOTE(JRC): Cached modes are static between inputs, so their last rendered
+// frame is presented again (i.e. rendering is skipped) until 'version' changes.
+constexpr static bool32_t MODE_CACHED[] = {
+    false, true, true, false, true, true };
 constexpr static uint32_t MODE_COUNT = LLCE_ELEM_COUNT( MODE_INIT_FUNS );
 
+static_assert( LLCE_ELEM_COUNT(MODE_CACHED) == MODE_COUNT,
+    "Incorrect number of cached mode flags; please add an entry to 'MODE_CACHED' for each mode." );
+
+/// Helper Functions ///
+
+// NOTE(JRC): Menu visuals are fully determined by the menu selections and the
+// mode's scratch memory (which holds its menu), so a change in either is
+// detected by comparing hashes (FNV-1a) of their bytes across an update.
+static uint64_t mode_hash( const ssn::state_t* pState ) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const auto cHashBytes = [&hash] ( const void* pBytes, const uint32_t pByteCount ) {
+        const bit8_t* cBytes = static_cast<const bit8_t*>( pBytes );
+        for( uint32_t byteIdx = 0; byteIdx < pByteCount; byteIdx++ ) {
+            hash = ( hash ^ static_cast<uint8_t>(cBytes[byteIdx]) ) * 0x100000001b3ull;
+        }
+    };
+
+    cHashBytes( &pState->selectMenuIndex, sizeof(pState->selectMenuIndex) );
+    cHashBytes( &pState->selectBotTeams, sizeof(pState->selectBotTeams) );
+    const void* cScratch = ssn::scratch::get( pState, pState->scratch.mBytes );
+    if( cScratch != nullptr ) {
+        cHashBytes( cScratch, pState->scratch.mBytes );
+    }
+    return hash;
+}
+
 /// Interface Functions ///
 
 extern "C" bool32_t boot( ssn::output_t* pOutput ) {
@@ -46,7 +82,21 @@ extern "C" bool32_t boot( ssn::output_t* pOutput ) {
 
     // Initialize Sound //
 
-    // ... //
+    ssn::mixer::start();
+
+    // Initialize Telemetry //
+
+    const char8_t* cTelemetryPath = std::getenv( "SSN_TELEMETRY_PATH" );
+    if( cTelemetryPath != nullptr ) { ssn::telemetry::start( cTelemetryPath ); }
+
+    // Initialize Recording //
+
+    // NOTE(JRC): When 'SSN_REPLAY_PATH' is given, each round is recorded and then
+    // appended to the archive at that path once its scores have been tallied (i.e.
+    // when the score mode ends). The round in progress during a hot reload is
+    // discarded, since the recorder is stopped when this module is unloaded.
+    const char8_t* cReplayPath = std::getenv( "SSN_REPLAY_PATH" );
+    if( cReplayPath != nullptr ) { ssn::recorder::start( cReplayPath ); }
 
     return true;
 }
@@ -63,6 +113,7 @@ extern "C" bool32_t init( ssn::state_t* pState, ssn::input_t* pInput ) {
     pState->pmode = ssn::mode::title::ID;
 
     pState->rng = llce::rng_t( ssn::RNG_SEED );
+    pState->selectBotTeams = 0;
 
     // Initialize Input //
 
@@ -96,23 +147,90 @@ extern "C" bool32_t init( ssn::state_t* pState, ssn::input_t* pInput ) {
 
 
 extern "C" bool32_t update( ssn::state_t* pState, ssn::input_t* pInput, const ssn::output_t* pOutput, const float64_t pDT ) {
+    // NOTE(JRC): The mixer, telemetry log and recorder are closed whenever this
+    // module is unloaded (see 'ssn_mixer.cpp', 'ssn_telemetry.cpp' and
+    // 'ssn_recorder.cpp'), so they're restarted by the first update after a hot reload.
+    static bool32_t sModuleLoaded = false;
+    if( !sModuleLoaded ) {
+        ssn::mixer::start();
+        const char8_t* cTelemetryPath = std::getenv( "SSN_TELEMETRY_PATH" );
+        if( cTelemetryPath != nullptr && !ssn::telemetry::active() ) {
+            ssn::telemetry::start( cTelemetryPath, true );
+        }
+        const char8_t* cReplayPath = std::getenv( "SSN_REPLAY_PATH" );
+        if( cReplayPath != nullptr && !ssn::recorder::active() ) {
+            ssn::recorder::start( cReplayPath );
+        }
+        sModuleLoaded = true;
+    }
+
     if( pState->mode != pState->pmode ) {
         if( pState->pmode < 0 ) { return false; }
+        ssn::telemetry::mode( pState->tt, pState->mode, pState->pmode );
+        // NOTE(JRC): Latency histograms are dumped on mode changes when a
+        // path is given since the harness doesn't notify plugins on exit.
+        const char8_t* cLatencyPath = std::getenv( "SSN_LATENCY_PATH" );
+        if( cLatencyPath != nullptr ) { ssn::latency::dump( cLatencyPath ); }
+
+        // NOTE(JRC): A round's recording is handed off to the archive writer once
+        // its score mode ends, and is discarded if the game mode is left any
+        // other way. The round's random state is captured before 'game::init'
+        // since replays re-run the initialization (see 'ssn::replay_t::start').
+        if( pState->mode == ssn::mode::score::ID ) {
+            ssn::recorder::end( pState->scoreTotals );
+        } if( pState->pmode == ssn::mode::game::ID ) {
+            ssn::recorder::begin( pState->rng, pDT, pState->sid, pState->fid );
+        } else if( pState->mode != ssn::mode::game::ID || pState->pmode != ssn::mode::score::ID ) {
+            ssn::recorder::cancel();
+        }
+
+        ssn::scratch::release( pState );
         MODE_INIT_FUNS[pState->pmode]( pState, pInput );
         pState->mode = pState->pmode;
         pState->st = 0.0;
+        pState->version++;
+    } else if( !ssn::scratch::valid(pState) ) {
+        // NOTE(JRC): Scratch memory is lost on hot reloads and state restores,
+        // so the current mode is re-entered in order to rebuild it. The mode's
+        // clock restarts along with it since phased modes (e.g. score) keep their
+        // progress in scratch and would otherwise resume past their setup phase.
+        MODE_INIT_FUNS[pState->mode]( pState, pInput );
+        pState->st = 0.0;
+        pState->version++;
     }
 
     pState->dt = pDT;
     pState->tt += pDT;
     pState->st += pDT;
 
+    // NOTE(JRC): Game inputs are applied when they reach the paddles (see
+    // 'ssn::mode::game::update'), but menus respond to input within 'update'.
+    ssn::latency::input( ssn::mode::capture(pInput) );
+    const bool32_t cIsCached = MODE_CACHED[pState->mode];
+    const uint64_t cPrevHash = cIsCached ? mode_hash( pState ) : 0;
     bool32_t updateStatus = MODE_UPDATE_FUNS[pState->mode]( pState, pInput, pDT );
+    pState->version += ( !cIsCached || mode_hash(pState) != cPrevHash ) ? 1 : 0;
+    if( pState->mode != ssn::mode::game::ID ) { ssn::latency::apply(); }
     return updateStatus;
 }
 
 
 extern "C" bool32_t render( const ssn::state_t* pState, const ssn::input_t* pInput, const ssn::output_t* pOutput ) {
+    // NOTE(JRC): The presented frame is tracked outside of the state so that
+    // hot reloads (which reset it) always force a fresh render; state restores
+    // are caught by the version bump when 'update' rebuilds the scratch memory.
+    static bool32_t sHasPresented = false;
+    static ssn::mode_e sPresentedMode = ssn::mode::boot::ID;
+    static uint32_t sPresentedVersion = 0;
+    if( MODE_CACHED[pState->mode] && sHasPresented &&
+            sPresentedMode == pState->mode && sPresentedVersion == pState->version ) {
+        ssn::latency::present( pState->mode );
+        return true;
+    }
+    sHasPresented = true;
+    sPresentedMode = pState->mode;
+    sPresentedVersion = pState->version;
+
     llce::gfx::fbo_context_t metaFBOC(
         pOutput->gfxBufferFBOs[llce::output::BUFFER_SHARED_ID],
         pOutput->gfxBufferRess[llce::output::BUFFER_SHARED_ID] );
@@ -122,5 +240,6 @@ extern "C" bool32_t render( const ssn::state_t* pState, const ssn::input_t* pInp
     llce::gfx::render::box();
 
     bool32_t renderStatus = MODE_RENDER_FUNS[pState->mode]( pState, pInput, pOutput );
+    ssn::latency::present( pState->mode );
     return renderStatus;
 }
@@ -4,6 +4,7 @@
 #include <SDL2/SDL.h>
 
 #include "ssn_entities.h"
+#include "ssn_broadphase_t.h"
 #include "ssn_particles.h"
 #include "ssn_consts.h"
 
@@ -16,41 +17,57 @@ namespace ssn {
 
 /// State Types/Variables ///
 
+struct scratch_t {
+    uint64_t mEpoch; // acquisition epoch (see 'ssn::scratch')
+    uint32_t mBytes; // size of the acquired scratch memory; 0 if none
+    uint32_t mSlot;  // index of the acquired scratch arena
+};
+
+constexpr static uint32_t STATE_CACHE_LINE_BYTES = 64;
+
+// NOTE(JRC): The state is laid out by access frequency: the first cache line
+// holds the scalars read every tick, followed by the simulation arrays (each
+// starting on its own line), with data that's only touched on claims, mode
+// changes or by rendering (area history, effects, menus) placed at the end.
 struct state_t {
-    // Global State //
-    float64_t dt; // frame time
+    // Hot State //
+    alignas(STATE_CACHE_LINE_BYTES) float64_t dt; // frame time
     float64_t tt; // total time
     float64_t st; // state time
+    float64_t rt; // round time
+    float64_t ht; // hit time
 
     mode_e mode; // current mode
     mode_e pmode; // pending mode
 
-    llce::rng_t rng; // random number generator
+    stage_e sid; // stage id
+    format_e fid; // format id
 
-    // Game State //
-    float64_t rt; // round time
-    float64_t ht; // hit time
+    uint32_t puckCount;
+    uint32_t paddleCount;
 
-    stage_e sid; // stage id
+    // Simulation State //
+    alignas(STATE_CACHE_LINE_BYTES) entity_store_t entities;
+    alignas(STATE_CACHE_LINE_BYTES) puck_t pucks[MAX_PUCK_COUNT];
+    alignas(STATE_CACHE_LINE_BYTES) paddle_t paddles[MAX_PADDLE_COUNT]; // NOTE: paddle 'i' is on team 'i % 2'
+    alignas(STATE_CACHE_LINE_BYTES) broadphase_t broadphase;
+    alignas(STATE_CACHE_LINE_BYTES) bounds_t bounds; // NOTE: area history is stored last
 
-    bounds_t bounds;
-    puck_t puck;
-    paddle_t paddles[2];
-    particulator_t particulator;
+    // Cold State //
+    alignas(STATE_CACHE_LINE_BYTES) particulator_t particulator;
+
+    llce::rng_t rng; // random number generator
 
     // Scoring State //
     float32_t scoreTotals[2];
-    bit8_t scoreSamples[SCORE_SAMPLES_BYTES];
-    bool32_t scoreTallied;
-
-    float32_t tallyPoss[2];
 
     // Menu State //
-    llce::gui::menu_t titleMenu;
-    llce::gui::menu_t resetMenu;
-    llce::gui::bind_menu_t bindMenu;
-    bool8_t resetMenuUpdated;
     uint8_t selectMenuIndex;
+    uint8_t selectBotTeams; // bit (1 << 'ssn::team::*') set for each team played by a bot
+    uint32_t version; // incremented whenever the current mode's visuals change
+
+    // Scratch State //
+    scratch_t scratch; // current mode's scratch memory (see 'ssn_scratch.h')
 };
 
 /// Input/Output Types/Variables ///
@@ -58,6 +75,11 @@ struct state_t {
 typedef llce::input::input_t input_t;
 typedef llce::output::output_t<1, 0> output_t;
 
+struct actions_t {
+    uint16_t down;    // bit (1 << 'ssn::action::*') set while the action is held
+    uint16_t pressed; // bit (1 << 'ssn::action::*') set the frame the action is pressed
+};
+
 }
 
 /// Functions ///
@@ -0,0 +1,293 @@
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ssn_archive_t.h"
+
+namespace ssn {
+
+static_assert( sizeof(archive_t::entry_t) % archive_t::ALIGN_BYTES == 0,
+    "Incorrect archive entry size; please pad 'ssn::archive_t::entry_t' to a "
+    "multiple of 'ssn::archive_t::ALIGN_BYTES' so the trailer stays aligned." );
+
+/// Helper Functions ///
+
+static uint64_t align( const uint64_t pBytes ) {
+    return ( pBytes + archive_t::ALIGN_BYTES - 1 ) / archive_t::ALIGN_BYTES * archive_t::ALIGN_BYTES;
+}
+
+
+static uint64_t index_hash( const archive_t::entry_t* pEntries, const uint64_t pEntryCount ) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const bit8_t* cBytes = reinterpret_cast<const bit8_t*>( pEntries );
+    for( uint64_t byteIdx = 0; byteIdx < pEntryCount * sizeof(archive_t::entry_t); byteIdx++ ) {
+        hash = ( hash ^ static_cast<uint8_t>(cBytes[byteIdx]) ) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/// 'ssn::archive_t' Functions ///
+
+archive_t::archive_t() :
+        mData( nullptr ), mBytes( 0 ), mEntries( nullptr ), mTrailer( nullptr ) {
+
+}
+
+
+archive_t::~archive_t() {
+    close();
+}
+
+
+bool32_t archive_t::open( const char8_t* pPath ) {
+    close();
+
+    const int32_t cFile = ::open( pPath, O_RDONLY );
+    LLCE_CHECK_WARNING( cFile >= 0,
+        "Couldn't open archive; failed to open file '" << pPath << "' for reading." );
+    if( cFile < 0 ) {
+        return false;
+    }
+
+    struct stat fileStat;
+    void* fileData = MAP_FAILED;
+    if( ::fstat(cFile, &fileStat) == 0 && fileStat.st_size >= static_cast<off_t>(sizeof(trailer_t)) ) {
+        fileData = ::mmap( nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, cFile, 0 );
+    }
+    // NOTE(JRC): The mapping holds its own reference to the file.
+    ::close( cFile );
+
+    if( fileData != MAP_FAILED ) {
+        mData = static_cast<const bit8_t*>( fileData );
+        mBytes = static_cast<uint64_t>( fileStat.st_size );
+        mTrailer = reinterpret_cast<const trailer_t*>( &mData[mBytes - sizeof(trailer_t)] );
+    }
+
+    const bool32_t cIsValid = mTrailer != nullptr &&
+        mTrailer->mMagic == archive_t::MAGIC && mTrailer->mVersion == archive_t::VERSION &&
+        mTrailer->mIndexOffset % archive_t::ALIGN_BYTES == 0 &&
+        mTrailer->mIndexOffset + mTrailer->mEntryCount * sizeof(entry_t) + sizeof(trailer_t) == mBytes;
+    LLCE_CHECK_WARNING( cIsValid,
+        "Couldn't open archive; file '" << pPath << "' is truncated or isn't a " <<
+        "version " << archive_t::VERSION << " archive." );
+    if( !cIsValid ) {
+        close();
+        return false;
+    }
+
+    mEntries = reinterpret_cast<const entry_t*>( &mData[mTrailer->mIndexOffset] );
+
+    const bool32_t cIsIndexIntact = index_hash( mEntries, mTrailer->mEntryCount ) == mTrailer->mIndexHash;
+    LLCE_CHECK_WARNING( cIsIndexIntact,
+        "Couldn't open archive; file '" << pPath << "' has a corrupt index " <<
+        "(e.g. from an interrupted append)." );
+    if( !cIsIndexIntact ) {
+        close();
+        return false;
+    }
+
+    // NOTE(JRC): Entries are checked up front so that 'header' and 'stream'
+    // can read the mapping without any bounds checks.
+    bool32_t areEntriesValid = true;
+    for( uint64_t entryIdx = 0; entryIdx < mTrailer->mEntryCount && areEntriesValid; entryIdx++ ) {
+        const entry_t& cEntry = mEntries[entryIdx];
+        areEntriesValid = cEntry.mOffset % archive_t::ALIGN_BYTES == 0 &&
+            cEntry.mBytes >= sizeof(replay_t::header_t) &&
+            cEntry.mOffset + cEntry.mBytes <= mTrailer->mIndexOffset;
+        if( areEntriesValid ) {
+            const replay_t::header_t* cHeader = header( entryIdx );
+            areEntriesValid = cHeader->mMagic == replay_t::MAGIC &&
+                cHeader->mVersion == replay_t::VERSION &&
+                cHeader->mStateBytes == sizeof(ssn::state_t) &&
+                cHeader->mStreamBytes <= cEntry.mBytes - sizeof(replay_t::header_t);
+        }
+    }
+    LLCE_CHECK_WARNING( areEntriesValid,
+        "Couldn't open archive; file '" << pPath << "' has an index entry " <<
+        "that lies outside of its replay data or was recorded by another build." );
+    if( !areEntriesValid ) {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+
+void archive_t::close() {
+    if( mData != nullptr ) {
+        ::munmap( const_cast<bit8_t*>(mData), mBytes );
+    }
+
+    mData = nullptr;
+    mBytes = 0;
+    mEntries = nullptr;
+    mTrailer = nullptr;
+}
+
+
+const replay_t::header_t* archive_t::header( const uint64_t pIndex ) const {
+    return reinterpret_cast<const replay_t::header_t*>( &mData[mEntries[pIndex].mOffset] );
+}
+
+
+const bit8_t* archive_t::stream( const uint64_t pIndex ) const {
+    return &mData[mEntries[pIndex].mOffset + sizeof(replay_t::header_t)];
+}
+
+
+/// 'ssn::archive_writer_t' Functions ///
+
+archive_writer_t::archive_writer_t() : mFile( nullptr ), mOffset( 0 ) {
+
+}
+
+
+archive_writer_t::~archive_writer_t() {
+    close();
+}
+
+
+bool32_t archive_writer_t::open( const char8_t* pPath ) {
+    close();
+
+    // NOTE(JRC): New replays are written over the footer of an existing
+    // archive, and new archives start with an empty footer, so the file is a
+    // valid archive whenever no append is in progress.
+    std::FILE* existingFile = std::fopen( pPath, "rb" );
+    const bool32_t cIsNew = existingFile == nullptr;
+    if( !cIsNew ) {
+        std::fclose( existingFile );
+
+        archive_t existing;
+        if( !existing.open(pPath) ) {
+            return false;
+        }
+        for( uint64_t entryIdx = 0; entryIdx < existing.count(); entryIdx++ ) {
+            mEntries.push_back( existing.entry(entryIdx) );
+        }
+        mOffset = existing.index();
+        existing.close();
+
+        mFile = std::fopen( pPath, "r+b" );
+    } else {
+        mFile = std::fopen( pPath, "wb" );
+    }
+
+    LLCE_CHECK_WARNING( mFile != nullptr,
+        "Couldn't open archive; failed to open file '" << pPath << "' for writing." );
+    if( mFile == nullptr ) {
+        close();
+        return false;
+    }
+
+    if( cIsNew && !footer() ) {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+
+bool32_t archive_writer_t::append( replay_t* pReplay, const float32_t pScoreTotals[2] ) {
+    if( mFile == nullptr ) {
+        return false;
+    }
+
+    pReplay->flush();
+    const replay_t::header_t& cHeader = pReplay->mHeader;
+    const uint64_t cIndexOffset = mOffset;
+
+    archive_t::entry_t entry;
+    std::memset( &entry, 0, sizeof(entry) );
+    entry.mOffset = align( mOffset );
+    entry.mBytes = sizeof(replay_t::header_t) + pReplay->mStream.size();
+    entry.mTickCount = cHeader.mTickCount;
+    entry.mDuration = cHeader.mTickCount * cHeader.mDT;
+    entry.mScoreTotals[0] = pScoreTotals[0];
+    entry.mScoreTotals[1] = pScoreTotals[1];
+    entry.mStage = cHeader.mStage;
+    entry.mFormat = cHeader.mFormat;
+
+    const bool32_t cAppended = std::fseek( mFile, static_cast<long>(mOffset), SEEK_SET ) == 0 &&
+        pad() &&
+        write( &cHeader, sizeof(cHeader) ) &&
+        write( pReplay->mStream.data(), pReplay->mStream.size() );
+    LLCE_CHECK_WARNING( cAppended,
+        "Couldn't append replay to archive; write of " << entry.mBytes << " bytes failed." );
+    if( !cAppended ) {
+        mOffset = cIndexOffset;
+        return false;
+    }
+
+    mEntries.push_back( entry );
+    if( !footer() ) {
+        mEntries.pop_back();
+        mOffset = cIndexOffset;
+        return false;
+    }
+
+    return true;
+}
+
+
+bool32_t archive_writer_t::close() {
+    if( mFile == nullptr ) {
+        mEntries.clear();
+        return false;
+    }
+
+    const bool32_t cClosed = std::fclose( mFile ) == 0;
+    LLCE_CHECK_WARNING( cClosed, "Couldn't close archive; last footer may be incomplete." );
+
+    mFile = nullptr;
+    mOffset = 0;
+    mEntries.clear();
+    return cClosed;
+}
+
+
+bool32_t archive_writer_t::write( const void* pData, const uint64_t pBytes ) {
+    const bool32_t cWritten = std::fwrite( pData, 1, pBytes, mFile ) == pBytes;
+    mOffset += cWritten ? pBytes : 0;
+    return cWritten;
+}
+
+
+bool32_t archive_writer_t::pad() {
+    const static bit8_t csPadding[archive_t::ALIGN_BYTES] = { 0 };
+    return write( &csPadding[0], align(mOffset) - mOffset );
+}
+
+
+bool32_t archive_writer_t::footer() {
+    bool32_t written = pad();
+    const uint64_t cIndexOffset = mOffset;
+
+    archive_t::trailer_t trailer;
+    std::memset( &trailer, 0, sizeof(trailer) );
+    trailer.mIndexOffset = cIndexOffset;
+    trailer.mEntryCount = mEntries.size();
+    trailer.mIndexHash = index_hash( mEntries.data(), mEntries.size() );
+    trailer.mMagic = archive_t::MAGIC;
+    trailer.mVersion = archive_t::VERSION;
+
+    // NOTE(JRC): The replay and index are synced before the trailer is written
+    // so that the trailer never lands ahead of the data it describes; the next
+    // append starts over this footer, so the offset is rewound to the index.
+    written = written &&
+        write( mEntries.data(), mEntries.size() * sizeof(archive_t::entry_t) ) &&
+        std::fflush( mFile ) == 0 && ::fsync( ::fileno(mFile) ) == 0 &&
+        write( &trailer, sizeof(trailer) ) &&
+        std::fflush( mFile ) == 0;
+    LLCE_CHECK_WARNING( written, "Couldn't write archive index; archive is incomplete." );
+
+    mOffset = cIndexOffset;
+    return written;
+}
+
+}
@@ -0,0 +1,121 @@
+#ifndef SSN_ARCHIVE_T_H
+#define SSN_ARCHIVE_T_H
+
+#include <cstdio>
+#include <vector>
+
+#include "ssn_replay_t.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+// NOTE(JRC): An archive is an append-only sequence of replays followed by a
+// footer index (one 'entry_t' per replay) and a fixed-size trailer, i.e.:
+//
+//   [replay 0][replay 1]...[replay N-1][entry 0]...[entry N-1][trailer]
+//
+// where each replay is a 'replay_t::header_t' followed by its stream (see
+// 'ssn::replay_t'). Replays are padded to 'ALIGN_BYTES' so every structure can
+// be read in-place from a memory mapping. Each append writes its replay over
+// the current footer and then writes the new footer after it (trailer last),
+// so appends cost O(replay + index) rather than leaving dead footers behind.
+// The trailer holds a hash of the index, so an append that's interrupted
+// before its trailer lands is detected (and rejected) when the file is opened.
+class archive_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t MAGIC = 0x414e5353; // units: 'SSNA' (little endian)
+    constexpr static uint32_t VERSION = 3;
+    constexpr static uint32_t ALIGN_BYTES = 16;
+
+    /// Class Types ///
+
+    struct entry_t {
+        uint64_t mOffset;         // units: bytes from the start of the archive
+        uint64_t mBytes;          // units: bytes of the replay header and stream
+        uint64_t mTickCount;
+        float64_t mDuration;      // units: seconds
+        float32_t mScoreTotals[2];
+        stage_e mStage;
+        format_e mFormat;
+    };
+
+    struct trailer_t {
+        uint64_t mIndexOffset;    // units: bytes from the start of the archive
+        uint64_t mEntryCount;
+        uint64_t mIndexHash;      // units: FNV-1a hash of the index's bytes
+        uint32_t mMagic;
+        uint32_t mVersion;
+    };
+
+    /// Constructors ///
+
+    archive_t();
+    ~archive_t();
+
+    archive_t( const archive_t& ) = delete;
+    archive_t& operator=( const archive_t& ) = delete;
+
+    /// Class Functions ///
+
+    bool32_t open( const char8_t* pPath );
+    void close();
+
+    uint64_t count() const { return ( mTrailer != nullptr ) ? mTrailer->mEntryCount : 0; }
+    uint64_t index() const { return ( mTrailer != nullptr ) ? mTrailer->mIndexOffset : 0; }
+    const entry_t& entry( const uint64_t pIndex ) const { return mEntries[pIndex]; }
+
+    const replay_t::header_t* header( const uint64_t pIndex ) const;
+    const bit8_t* stream( const uint64_t pIndex ) const;
+
+    /// Class Fields ///
+
+    private:
+
+    const bit8_t* mData;
+    uint64_t mBytes;
+    const entry_t* mEntries;
+    const trailer_t* mTrailer;
+};
+
+
+class archive_writer_t {
+    public:
+
+    /// Constructors ///
+
+    archive_writer_t();
+    ~archive_writer_t();
+
+    archive_writer_t( const archive_writer_t& ) = delete;
+    archive_writer_t& operator=( const archive_writer_t& ) = delete;
+
+    /// Class Functions ///
+
+    bool32_t open( const char8_t* pPath );
+    bool32_t append( replay_t* pReplay, const float32_t pScoreTotals[2] );
+    bool32_t close();
+
+    /// Helper Functions ///
+
+    private:
+
+    bool32_t write( const void* pData, const uint64_t pBytes );
+    bool32_t pad();
+    bool32_t footer();
+
+    /// Class Fields ///
+
+    private:
+
+    std::FILE* mFile;
+    uint64_t mOffset; // units: bytes to the end of the replays (i.e. the start of the index)
+    std::vector<archive_t::entry_t> mEntries;
+};
+
+}
+
+#endif
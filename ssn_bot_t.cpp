@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+#include "ssn_entities.h"
+#include "ssn_wrap.h"
+#include "ssn_bot_t.h"
+
+namespace ssn {
+
+/// Helper Variables ///
+
+constexpr static uint32_t TEAM_UP_ACTIONS[] = { ssn::action::lup, ssn::action::rup };
+constexpr static uint32_t TEAM_DOWN_ACTIONS[] = { ssn::action::ldown, ssn::action::rdown };
+constexpr static uint32_t TEAM_LEFT_ACTIONS[] = { ssn::action::lleft, ssn::action::rleft };
+constexpr static uint32_t TEAM_RIGHT_ACTIONS[] = { ssn::action::lright, ssn::action::rright };
+constexpr static uint32_t TEAM_GO_ACTIONS[] = { ssn::action::lrush, ssn::action::rrush };
+
+/// Class Functions ///
+
+bot_t::bot_t( const ssn::team_e pTeam, const uint32_t pDepth, const uint32_t pBudget ) :
+        mTeam( pTeam ), mDepth( glm::clamp(pDepth, bot_t::MIN_DEPTH, bot_t::MAX_DEPTH) ), mBudget( pBudget ) {
+    std::memset( &mTarget, 0, sizeof(mTarget) );
+    std::memset( &mStats, 0, sizeof(mStats) );
+}
+
+
+ssn::actions_t bot_t::act( const ssn::state_t* pState ) {
+    const auto cStartTime = std::chrono::steady_clock::now();
+    ssn::actions_t actions = { 0, 0 };
+
+    // NOTE(JRC): All of a team's paddles share the team's inputs, so the
+    // team's first paddle (paddle 'i' is on team 'i % 2') is the one steered.
+    if( pState->paddleCount <= static_cast<uint32_t>(mTeam) ) {
+        return actions;
+    }
+    const ssn::paddle_t& cPaddle = pState->paddles[mTeam];
+    const vec2f32_t cPaddlePos = ssn::real::tof( cPaddle.pos() );
+    const float32_t cPaddleRadius = ssn::real::tof( cPaddle.radius() );
+
+    mTarget = predict( pState, cPaddlePos );
+
+    { // Choose Actions //
+        // NOTE(JRC): Without a reachable interception, the bot returns to the
+        // center of its own half of the stage to wait for the next volley.
+        const llce::box_t& cBBox = pState->bounds.mBBox;
+        const vec2f32_t cHomePos = cBBox.min() + cBBox.mDims * vec2f32_t(
+            ( mTeam == ssn::team::left ) ? 0.25f : 0.75f, 0.5f );
+        const vec2f32_t cGoalPos = mTarget.mValid ? mTarget.mPos : cHomePos;
+        const vec2f32_t cGoalDelta = cGoalPos - cPaddlePos;
+        const float32_t cDeadzone = 2.5e-1f * cPaddleRadius;
+
+        actions.down |= ( cGoalDelta.y > +cDeadzone ) ? ( 1 << TEAM_UP_ACTIONS[mTeam] ) : 0;
+        actions.down |= ( cGoalDelta.y < -cDeadzone ) ? ( 1 << TEAM_DOWN_ACTIONS[mTeam] ) : 0;
+        actions.down |= ( cGoalDelta.x < -cDeadzone ) ? ( 1 << TEAM_LEFT_ACTIONS[mTeam] ) : 0;
+        actions.down |= ( cGoalDelta.x > +cDeadzone ) ? ( 1 << TEAM_RIGHT_ACTIONS[mTeam] ) : 0;
+
+        // NOTE(JRC): Rushes are saved for interceptions that are about to be
+        // missed, i.e. ones that are imminent and farther than a rush covers.
+        const float32_t cRushReach = ssn::paddle_t::RUSH_VEL * ssn::paddle_t::RUSH_DURATION;
+        const bool32_t cShouldRush = mTarget.mValid &&
+            mTarget.mTime <= 2.0f * ssn::paddle_t::RUSH_DURATION &&
+            glm::length( cGoalDelta ) > cPaddleRadius && glm::length( cGoalDelta ) < cRushReach;
+        actions.pressed |= cShouldRush ? ( 1 << TEAM_GO_ACTIONS[mTeam] ) : 0;
+    }
+
+    mStats.mTime = std::chrono::duration<float64_t>(
+        std::chrono::steady_clock::now() - cStartTime ).count();
+    mStats.mMaxTime = std::max( mStats.mMaxTime, mStats.mTime );
+    return actions;
+}
+
+/// Helper Functions ///
+
+bot_t::target_t bot_t::predict( const ssn::state_t* pState, const vec2f32_t& pPaddlePos ) {
+    // NOTE(JRC): Pucks are predicted with the same 'real_t' math and wrap
+    // helpers as 'puck_t::resolve' and 'puck_t::hit' so that predictions
+    // agree with the simulation (including at the container boundaries).
+    const llce::box_t& cBBox = pState->bounds.mBBox;
+    const vec2r_t cBoundsMin = ssn::real::tor( cBBox.min() ), cBoundsMax = ssn::real::tor( cBBox.max() );
+    const vec2r_t cBoundsDims = ssn::real::tor( cBBox.mDims );
+    const vec2r_t cPaddlePos = ssn::real::tor( pPaddlePos );
+    const float32_t cDT = static_cast<float32_t>( ( pState->dt > 0.0 ) ? pState->dt : 1.0 / 60.0 );
+    const real_t cRealDT = ssn::real::tor( cDT );
+    const float32_t cReachVel = ssn::paddle_t::MOVE_MAX_VEL;
+    // NOTE(JRC): Each step tests the puck against every other paddle and then
+    // against this bot's paddle, so this bounds the work of a step.
+    const uint32_t cStepWork = pState->paddleCount + 1;
+
+    target_t target;
+    std::memset( &target, 0, sizeof(target) );
+    target.mTime = static_cast<float32_t>( mDepth ) * cDT;
+
+    mStats.mSteps = 0;
+    mStats.mWork = 0;
+    bool32_t isBudgetCut = false;
+
+    for( uint32_t puckIdx = 0; puckIdx < pState->puckCount && !isBudgetCut; puckIdx++ ) {
+        const ssn::puck_t& cPuck = pState->pucks[puckIdx];
+        const real_t cPuckRadius = cPuck.radius();
+
+        // NOTE(JRC): Paddles are assumed to be stationary for the duration of
+        // the prediction; the prediction is refreshed every tick anyway.
+        vec2r_t puckPos = cPuck.pos();
+        vec2r_t puckVel = cPuck.vel();
+        vec2i8_t puckWrapCount = cPuck.mWrapCount;
+        uint8_t puckTeam = cPuck.team();
+
+        // Returns the displacement from the given paddle position to the puck
+        // image nearest to it along with whether that image is tangible to the
+        // given team (see 'puck_t::hit').
+        const auto cContact = [&] ( const vec2r_t& pPaddlePos, const uint8_t pTeam, vec2r_t* pDelta ) {
+            vec2i8_t puckImage;
+            *pDelta = ssn::wrap::delta( pPaddlePos, puckPos, cBoundsDims, &puckImage );
+            const vec2i8_t cImageTangible = ssn::puck_t::tangible( puckTeam, ssn::puck_t::wrapcount(
+                puckWrapCount, puckPos, cPuckRadius, puckImage, cBoundsMin, cBoundsMax) );
+            return static_cast<bool32_t>( *LLCE_VECTOR_AT(cImageTangible, pTeam) );
+        };
+
+        for( uint32_t stepIdx = 1; stepIdx <= mDepth; stepIdx++ ) {
+            if( mStats.mWork + cStepWork > mBudget ) {
+                isBudgetCut = true;
+                break;
+            }
+            mStats.mWork += cStepWork;
+            mStats.mSteps++;
+
+            const float32_t cStepTime = static_cast<float32_t>( stepIdx ) * cDT;
+            if( cStepTime >= target.mTime ) {
+                break;
+            }
+
+            { // Integrate and Wrap (see 'puck_t::resolve') //
+                const vec2r_t cPrevPos = puckPos;
+                puckPos += cRealDT * puckVel;
+                for( uint32_t axis = 0; axis < 2; axis++ ) {
+                    const real_t cMin = cBoundsMin[axis], cMax = cBoundsMax[axis];
+                    const bool32_t cIsPrevWrap =
+                        cPrevPos[axis] - cPuckRadius < cMin || cPrevPos[axis] + cPuckRadius > cMax;
+                    const bool32_t cIsCurrWrap =
+                        puckPos[axis] - cPuckRadius < cMin || puckPos[axis] + cPuckRadius > cMax;
+                    puckWrapCount[axis] += ( !cIsPrevWrap && cIsCurrWrap ) ?
+                        ( (puckPos[axis] - cPuckRadius < cMin) ? -1 : 1 ) : 0;
+                    puckPos[axis] = cPuckRadius +
+                        ssn::real::wrap( puckPos[axis] - cPuckRadius, cMin, cMax - cMin );
+                }
+            }
+
+            { // Reflect off of Other Paddles (see 'puck_t::hit') //
+                for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+                    const ssn::paddle_t& cPaddle = pState->paddles[paddleIdx];
+                    const uint8_t cPaddleTeam = cPaddle.team();
+                    vec2r_t hitDelta;
+                    if( cPaddleTeam == mTeam || !cContact(cPaddle.pos(), cPaddleTeam, &hitDelta) ) {
+                        continue;
+                    }
+
+                    const real_t cHitDist = cPuckRadius + cPaddle.radius();
+                    if( ssn::real::dot(hitDelta, hitDelta) < cHitDist * cHitDist ) {
+                        const real_t cHitMag = ssn::real::clamp(
+                            ssn::real::tor( ssn::puck_t::VEL_MULTIPLIER ) * ssn::real::length( puckVel ),
+                            ssn::real::tor( ssn::puck_t::MIN_VEL ), ssn::real::tor( ssn::puck_t::MAX_VEL ) );
+                        puckVel = ssn::real::normalize( hitDelta ) * cHitMag;
+                        puckWrapCount = vec2i8_t( 0, 0 );
+                        puckTeam = cPaddleTeam;
+                        break;
+                    }
+                }
+            }
+
+            // NOTE(JRC): An interception is reachable if the paddle can cover
+            // the distance to the nearest puck image (less the contact distance)
+            // at its top speed before the puck arrives.
+            vec2r_t reachDelta;
+            if( cContact(cPaddlePos, mTeam, &reachDelta) ) {
+                const float32_t cReachDist = std::max( 0.0f,
+                    ssn::real::tof(ssn::real::length(reachDelta) - cPuckRadius) );
+                if( cReachDist <= cReachVel * cStepTime ) {
+                    target.mPos = pPaddlePos + ssn::real::tof( reachDelta );
+                    target.mTime = cStepTime;
+                    target.mPuck = puckIdx;
+                    target.mValid = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    mStats.mCutCount += isBudgetCut ? 1 : 0;
+    return target;
+}
+
+}
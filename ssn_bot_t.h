@@ -0,0 +1,72 @@
+#ifndef SSN_BOT_T_H
+#define SSN_BOT_T_H
+
+#include "ssn.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+// NOTE(JRC): A computer player for one team that produces the same
+// 'ssn::actions_t' as a human (i.e. the output can be OR'd into the actions
+// captured from 'ssn::input_t'). Each tick, it predicts the paths of all pucks
+// (wrapping at the bounds, flipping their tangibility via 'puck_t::tangible',
+// and reflecting off of every other paddle they can hit) and then steers its
+// team toward the earliest reachable interception. Prediction stops early if
+// it exhausts the bot's work budget (counted in puck/paddle contact tests
+// rather than time), so the cost per tick is capped and bots still always act
+// the same way in the same state, which lets their rounds be replayed.
+class bot_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t MIN_DEPTH = 1;     // units: prediction steps
+    constexpr static uint32_t MAX_DEPTH = 512;   // units: prediction steps
+    constexpr static uint32_t DEFAULT_BUDGET = 1 << 12; // units: contact tests per tick
+
+    /// Class Types ///
+
+    struct target_t {
+        vec2f32_t mPos;  // units: world
+        float32_t mTime; // units: seconds from now
+        uint32_t mPuck;
+        bool32_t mValid;
+    };
+
+    struct stats_t {
+        float64_t mTime;      // units: seconds spent in the last 'act'
+        float64_t mMaxTime;   // units: seconds
+        uint32_t mSteps;      // units: prediction steps taken in the last 'act'
+        uint32_t mWork;       // units: contact tests done in the last 'act'
+        uint64_t mCutCount;   // units: calls to 'act' cut short by the budget
+    };
+
+    /// Constructors ///
+
+    bot_t( const ssn::team_e pTeam, const uint32_t pDepth = 120, const uint32_t pBudget = DEFAULT_BUDGET );
+
+    /// Class Functions ///
+
+    ssn::actions_t act( const ssn::state_t* pState );
+
+    /// Helper Functions ///
+
+    private:
+
+    target_t predict( const ssn::state_t* pState, const vec2f32_t& pPaddlePos );
+
+    /// Class Fields ///
+
+    public:
+
+    ssn::team_e mTeam;
+    uint32_t mDepth;    // units: prediction steps; higher is a stronger opponent
+    uint32_t mBudget;   // units: contact tests per tick
+    target_t mTarget;
+    stats_t mStats;
+};
+
+}
+
+#endif
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "ssn_wrap.h"
+#include "ssn_broadphase_t.h"
+
+namespace ssn {
+
+/// Helper Functions ///
+
+static void sweep( const entity_t* pEntity, const uint32_t pAxis, const real_t pDT,
+        real_t* pMin, real_t* pMax ) {
+    const real_t cCurrPos = pEntity->pos()[pAxis];
+    const real_t cPrevPos = cCurrPos - pDT * pEntity->vel()[pAxis];
+    *pMin = ssn::real::min( cCurrPos, cPrevPos ) - pEntity->radius();
+    *pMax = ssn::real::max( cCurrPos, cPrevPos ) + pEntity->radius();
+}
+
+/// Class Functions ///
+
+broadphase_t::broadphase_t() : mProxyCount( 0 ), mPairCount( 0 ) {
+
+}
+
+
+void broadphase_t::reset( const uint32_t pPuckCount, const uint32_t pPaddleCount ) {
+    mProxyCount = 0;
+    mPairCount = 0;
+
+    // NOTE(JRC): Each puck gets a second proxy for its wrapped image along the
+    // sweep axis; this proxy is parked at infinity while the puck doesn't
+    // straddle the container boundary.
+    for( uint32_t puckIdx = 0; puckIdx < pPuckCount; puckIdx++ ) {
+        mProxies[mProxyCount++] = { real_t(0), real_t(0), static_cast<uint16_t>(puckIdx), broadphase_t::puck };
+        mProxies[mProxyCount++] = { real_t(0), real_t(0), static_cast<uint16_t>(puckIdx), broadphase_t::puckwrap };
+    } for( uint32_t paddleIdx = 0; paddleIdx < pPaddleCount; paddleIdx++ ) {
+        mProxies[mProxyCount++] = { real_t(0), real_t(0), static_cast<uint16_t>(paddleIdx), broadphase_t::paddle };
+    }
+}
+
+
+uint32_t broadphase_t::collide( const puck_t* pPucks, const paddle_t* pPaddles,
+        const llce::box_t& pContainer, const float64_t pDT ) {
+    const real_t cDT = ssn::real::tor( pDT );
+    const real_t cInfinity = ssn::real::infinity();
+    const vec2r_t cContainerMin = ssn::real::tor( pContainer.min() );
+    const vec2r_t cContainerMax = ssn::real::tor( pContainer.max() );
+    const vec2r_t cContainerDims = cContainerMax - cContainerMin;
+
+    { // Update Proxy Intervals //
+        for( uint32_t proxyIdx = 0; proxyIdx < mProxyCount; proxyIdx++ ) {
+            proxy_t& proxy = mProxies[proxyIdx];
+            const entity_t* proxyEntity = ( proxy.mKind == broadphase_t::paddle ) ?
+                static_cast<const entity_t*>( &pPaddles[proxy.mIndex] ) :
+                static_cast<const entity_t*>( &pPucks[proxy.mIndex] );
+            sweep( proxyEntity, 0, cDT, &proxy.mMin, &proxy.mMax );
+
+            // NOTE(JRC): Parked proxies are assigned (rather than offset) to
+            // infinity since fixed-point infinity can't absorb an addition.
+            if( proxy.mKind == broadphase_t::puckwrap ) {
+                const int8_t cImage = ssn::wrap::straddle(
+                    proxy.mMin, proxy.mMax, cContainerMin.x, cContainerMax.x );
+                if( cImage != 0 ) {
+                    proxy.mMin += real_t( cImage ) * cContainerDims.x;
+                    proxy.mMax += real_t( cImage ) * cContainerDims.x;
+                } else {
+                    proxy.mMin = proxy.mMax = cInfinity;
+                }
+            }
+        }
+    }
+
+    { // Sort Proxies Along Sweep Axis //
+        for( uint32_t proxyIdx = 1; proxyIdx < mProxyCount; proxyIdx++ ) {
+            const proxy_t cProxy = mProxies[proxyIdx];
+            uint32_t sortIdx = proxyIdx;
+            for( ; sortIdx > 0 && mProxies[sortIdx - 1].mMin > cProxy.mMin; sortIdx-- ) {
+                mProxies[sortIdx] = mProxies[sortIdx - 1];
+            }
+            mProxies[sortIdx] = cProxy;
+        }
+    }
+
+    mPairCount = 0;
+
+    { // Sweep for Overlapping Puck/Paddle Pairs //
+        // NOTE(JRC): Swept intervals are compared along the y-axis by the
+        // minimum-image distance between their midpoints, which matches the
+        // nearest-image contact test in 'puck_t::hit' since intervals are
+        // shorter than half the container. Pairs that overlap along the sweep
+        // axis are gathered into chunks so that these distances can be found
+        // in batch by 'wrap::deltas' (which is vectorized).
+        const real_t cHalf = ssn::real::tor( 0.5 );
+        pair_t chunkPairs[CHUNK_PAIR_COUNT];
+        real_t chunkFroms[CHUNK_PAIR_COUNT], chunkTos[CHUNK_PAIR_COUNT], chunkDeltas[CHUNK_PAIR_COUNT];
+        real_t chunkReaches[CHUNK_PAIR_COUNT]; // units: midpoint distance at which the pair's intervals touch
+        uint32_t chunkCount = 0;
+        uint32_t droppedCount = 0;
+
+        const auto cFlushChunk = [&] () {
+            ssn::wrap::deltas( &chunkFroms[0], &chunkTos[0], chunkCount, cContainerDims.y, &chunkDeltas[0] );
+            for( uint32_t chunkIdx = 0; chunkIdx < chunkCount; chunkIdx++ ) {
+                const real_t cMidDist = ( chunkDeltas[chunkIdx] < real_t(0) ) ?
+                    -chunkDeltas[chunkIdx] : chunkDeltas[chunkIdx];
+                if( cMidDist > chunkReaches[chunkIdx] ) {
+                    continue;
+                } if( mPairCount < MAX_PAIR_COUNT ) {
+                    mPairs[mPairCount++] = chunkPairs[chunkIdx];
+                } else {
+                    droppedCount++;
+                }
+            }
+            chunkCount = 0;
+        };
+
+        uint32_t activeIdxs[MAX_PROXY_COUNT];
+        uint32_t activeCount = 0;
+
+        for( uint32_t proxyIdx = 0; proxyIdx < mProxyCount && mProxies[proxyIdx].mMin != cInfinity; proxyIdx++ ) {
+            const proxy_t& proxy = mProxies[proxyIdx];
+
+            uint32_t keepCount = 0;
+            for( uint32_t activeIdx = 0; activeIdx < activeCount; activeIdx++ ) {
+                const proxy_t& active = mProxies[activeIdxs[activeIdx]];
+                if( active.mMax < proxy.mMin ) { continue; }
+                activeIdxs[keepCount++] = activeIdxs[activeIdx];
+
+                const bool32_t cIsProxyPaddle = proxy.mKind == broadphase_t::paddle;
+                const bool32_t cIsActivePaddle = active.mKind == broadphase_t::paddle;
+                if( cIsProxyPaddle != cIsActivePaddle ) {
+                    const pair_t cPair = {
+                        cIsProxyPaddle ? active.mIndex : proxy.mIndex,
+                        cIsProxyPaddle ? proxy.mIndex : active.mIndex };
+                    real_t puckMin, puckMax, paddleMin, paddleMax;
+                    sweep( &pPucks[cPair.mPuck], 1, cDT, &puckMin, &puckMax );
+                    sweep( &pPaddles[cPair.mPaddle], 1, cDT, &paddleMin, &paddleMax );
+
+                    chunkPairs[chunkCount] = cPair;
+                    chunkFroms[chunkCount] = cHalf * ( paddleMin + paddleMax );
+                    chunkTos[chunkCount] = cHalf * ( puckMin + puckMax );
+                    chunkReaches[chunkCount] = cHalf * ( (puckMax - puckMin) + (paddleMax - paddleMin) );
+                    if( ++chunkCount == CHUNK_PAIR_COUNT ) { cFlushChunk(); }
+                }
+            }
+            activeCount = keepCount;
+            activeIdxs[activeCount++] = proxyIdx;
+        }
+        cFlushChunk();
+
+        LLCE_CHECK_WARNING( droppedCount == 0,
+            "Broadphase pair buffer is full; " << droppedCount << " of the " <<
+            "potential collisions past " << MAX_PAIR_COUNT << " were dropped." );
+    }
+
+    { // Order and Deduplicate Pairs //
+        // NOTE(JRC): A puck and its wrapped image can both pair with the same
+        // paddle, and the narrowphase needs a stable order to be deterministic.
+        std::sort( &mPairs[0], &mPairs[mPairCount], [] ( const pair_t& pA, const pair_t& pB ) {
+            return ( pA.mPuck != pB.mPuck ) ? ( pA.mPuck < pB.mPuck ) : ( pA.mPaddle < pB.mPaddle ); } );
+        mPairCount = static_cast<uint32_t>( std::unique(&mPairs[0], &mPairs[mPairCount],
+            [] ( const pair_t& pA, const pair_t& pB ) {
+                return pA.mPuck == pB.mPuck && pA.mPaddle == pB.mPaddle; } ) - &mPairs[0] );
+    }
+
+    return mPairCount;
+}
+
+}
@@ -0,0 +1,61 @@
+#ifndef SSN_BROADPHASE_T_H
+#define SSN_BROADPHASE_T_H
+
+#include "box_t.h"
+
+#include "ssn_entities.h"
+#include "ssn_entity_store_t.h"
+#include "consts.h"
+
+namespace ssn {
+
+class broadphase_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t MAX_PROXY_COUNT = 2 * entity_store_t::MAX_ENTITY_COUNT;
+    constexpr static uint32_t MAX_PAIR_COUNT = 4 * entity_store_t::MAX_ENTITY_COUNT;
+    constexpr static uint32_t CHUNK_PAIR_COUNT = 64; // units: sweep candidates per y-axis batch
+
+    /// Class Types ///
+
+    enum kind_e : uint8_t { paddle = 0, puck, puckwrap };
+
+    struct proxy_t {
+        real_t mMin, mMax;    // units: world (x-axis)
+        uint16_t mIndex;      // units: index into the puck/paddle array
+        kind_e mKind;
+    };
+
+    struct pair_t {
+        uint16_t mPuck, mPaddle;
+    };
+
+    /// Constructors ///
+
+    broadphase_t();
+
+    /// Class Functions ///
+
+    void reset( const uint32_t pPuckCount, const uint32_t pPaddleCount );
+    uint32_t collide( const puck_t* pPucks, const paddle_t* pPaddles,
+        const llce::box_t& pContainer, const float64_t pDT );
+
+    /// Class Fields ///
+
+    public:
+
+    // NOTE(JRC): Proxies persist between frames so that the sort along the
+    // sweep axis starts out nearly ordered (entities move very little per
+    // frame), which makes the insertion sort used here close to linear.
+    proxy_t mProxies[MAX_PROXY_COUNT];
+    uint32_t mProxyCount;
+
+    pair_t mPairs[MAX_PAIR_COUNT];
+    uint32_t mPairCount;
+};
+
+}
+
+#endif
@@ -13,6 +13,7 @@ LLCE_ACTION_ENUM(
 
 LLCE_ENUM( team, left, right, neutral );
 LLCE_ENUM( stage, box, vert, horz, wild );
+LLCE_ENUM( format, duel, melee );
 
 typedef int32_t mode_e;
 
@@ -29,6 +30,15 @@ constexpr static vec2f32_t STAGE_SPECS[] = {
     {1.0f, 0.75f},
     {0.60f, 0.80f}
 };
+// NOTE(JRC): Stages are centered in the unit square (see 'ssn::mode::game::init'),
+// so their container bounds are compile-time constants; these are used by the
+// stage-specialized simulation kernels (e.g. 'ssn::puck_t::resolve<S>').
+constexpr static float32_t stage_min( const uint32_t pStage, const uint32_t pAxis ) {
+    return 0.5f - 0.5f * ( pAxis ? STAGE_SPECS[pStage].y : STAGE_SPECS[pStage].x );
+}
+constexpr static float32_t stage_max( const uint32_t pStage, const uint32_t pAxis ) {
+    return stage_min( pStage, pAxis ) + ( pAxis ? STAGE_SPECS[pStage].y : STAGE_SPECS[pStage].x );
+}
 constexpr static char8_t STAGE_NAMES[][8] = {
     "BOX",
     "VERT",
@@ -36,6 +46,24 @@ constexpr static char8_t STAGE_NAMES[][8] = {
     "WILD"
 };
 
+// NOTE(JRC): Formats place their paddles (per team) and pucks on grids of
+// the given dimensions (columns, rows) spread across the stage.
+constexpr static vec2u32_t FORMAT_PADDLE_GRIDS[] = {
+    {1, 1},
+    {2, 8}
+};
+constexpr static vec2u32_t FORMAT_PUCK_GRIDS[] = {
+    {1, 1},
+    {10, 10}
+};
+constexpr static char8_t FORMAT_TAGS[][4] = {
+    "",
+    "+"
+};
+
+constexpr static uint32_t MAX_PADDLE_COUNT = 64;
+constexpr static uint32_t MAX_PUCK_COUNT = 128;
+
 constexpr static float64_t HIT_DURATION = 0.3; // units: seconds
 constexpr static float64_t ROUND_DURATION = 120.0; // units: seconds
 
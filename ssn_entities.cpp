@@ -1,3 +1,5 @@
+#include <cmath>
+#include <cstring>
 #include <limits>
 
 #include <SDL2/SDL_opengl.h>
@@ -9,33 +11,49 @@
 #include "gfx.h"
 #include "util.hpp"
 #include "ssn_entities.h"
+#include "ssn_wrap.h"
 
 namespace ssn {
 
-/// 'ssn::team_entity_t' Functions ///
+/// Helper Functions ///
 
-team_entity_t::team_entity_t( const llce::box_t& pBBox, const team::team_e& pTeam ) :
-        entity_t( pBBox, &ssn::color::TEAM[pTeam] ), mTeam( pTeam ) {
-    
+template <stage_e S>
+static inline vec2r_t stage_container_min() {
+    return vec2r_t( ssn::real::tor(ssn::stage_min(S, 0)), ssn::real::tor(ssn::stage_min(S, 1)) );
 }
 
+template <stage_e S>
+static inline vec2r_t stage_container_max() {
+    return vec2r_t( ssn::real::tor(ssn::stage_max(S, 0)), ssn::real::tor(ssn::stage_max(S, 1)) );
+}
+
+template <stage_e S>
+static inline vec2r_t stage_container_dims() {
+    return ssn::real::tor( ssn::STAGE_SPECS[S] );
+}
 
-team_entity_t::team_entity_t( const llce::circle_t& pBounds, const team::team_e& pTeam ) :
-        entity_t( pBounds, &ssn::color::TEAM[pTeam] ), mTeam( pTeam ) {
+/// 'ssn::team_entity_t' Functions ///
+
+team_entity_t::team_entity_t( entity_store_t* pStore, const llce::circle_t& pBounds, const team::team_e& pTeam ) :
+        entity_t( pStore, pBounds, pTeam ) {
     
 }
 
 
 void team_entity_t::change( const team::team_e& pTeam ) {
-    mColor = &ssn::color::TEAM[(mTeam = pTeam)];
+    team() = pTeam;
 }
 
 /// 'ssn::bounds_t' Functions ///
 
 bounds_t::bounds_t( const llce::box_t& pBBox ) :
-        entity_t( pBBox, &ssn::color::BACKGROUND ) {
+        mBBox( pBBox ) {
     mCurrAreaTeam = ssn::team::neutral;
     mCurrAreaCount = mAreaCount = 0;
+
+    std::memset( &mCurrAreaCorners[0], 0, sizeof(mCurrAreaCorners) );
+    std::memset( &mAreaCorners[0], 0, sizeof(mAreaCorners) );
+    std::memset( &mAreaTeams[0], 0, sizeof(mAreaTeams) );
 }
 
 
@@ -46,7 +64,7 @@ void bounds_t::render() const {
     // because the annotations are relative to the world and not to the 'bounds_t'
     // container object, though it may lead to trouble should the world be changed
     // to have a different reference frame at some point in the future.
-    llce::gfx::color_context_t entityCC( mColor );
+    llce::gfx::color_context_t entityCC( &ssn::color::BACKGROUND );
     llce::gfx::render::box( mBBox );
 
     glBegin( GL_TRIANGLES );
@@ -72,13 +90,19 @@ void bounds_t::render() const {
 
 
 void bounds_t::claim( const team_entity_t* pSource ) {
-    if( pSource->mTeam != mCurrAreaTeam ) {
-        mCurrAreaTeam = pSource->mTeam;
+    if( pSource->team() != mCurrAreaTeam ) {
+        mCurrAreaTeam = pSource->team();
         mCurrAreaCount = 0;
     }
 
-    mCurrAreaCorners[mCurrAreaCount++] = pSource->mBounds.mCenter;
-    if( mCurrAreaCount == bounds_t::AREA_CORNER_COUNT ) {
+    mCurrAreaCorners[mCurrAreaCount++] = ssn::real::tof( pSource->pos() );
+    if( mCurrAreaCount == bounds_t::AREA_CORNER_COUNT && mAreaCount >= bounds_t::AREA_MAX_COUNT ) {
+        LLCE_CHECK_WARNING( false,
+            "Couldn't claim area due to insufficient space; " <<
+            "all " << bounds_t::AREA_MAX_COUNT << " area slots are in use." );
+        mCurrAreaTeam = ssn::team::neutral;
+        mCurrAreaCount = 0;
+    } else if( mCurrAreaCount == bounds_t::AREA_CORNER_COUNT ) {
         for( uint32_t cornerIdx = 0; cornerIdx < AREA_CORNER_COUNT; cornerIdx++ ) {
             uint32_t areaCornerIdx = mAreaCount * AREA_CORNER_COUNT + cornerIdx;
             mAreaCorners[areaCornerIdx] = mCurrAreaCorners[cornerIdx];
@@ -92,67 +116,73 @@ void bounds_t::claim( const team_entity_t* pSource ) {
 
 /// 'ssn::paddle_t' Functions ///
 
-paddle_t::paddle_t( const llce::circle_t& pBounds, const team::team_e& pTeam, const entity_t* pContainer ) :
-        team_entity_t( pBounds, pTeam ), mContainer( pContainer ), mDI( 0, 0 ),
-        mAmRushing( false ), mRushDuration( 0.0f ), mRushCooldown( 0.0f ) {
-    
+paddle_t::paddle_t( entity_store_t* pStore, const llce::circle_t& pBounds, const team::team_e& pTeam, const bounds_t* pContainer ) :
+        team_entity_t( pStore, pBounds, pTeam ), mDI( real_t(0), real_t(0) ),
+        mAmRushing( false ), mRushDuration( real_t(0) ), mRushCooldown( real_t(0) ) {
+    mContainer.set( pContainer );
 }
 
 
 void paddle_t::update( const float64_t pDT ) {
+    const real_t cDT = ssn::real::tor( pDT );
+    const real_t cRushDuration = ssn::real::tor( paddle_t::RUSH_DURATION );
+
     { // Update Rush State Information //
-        mRushDuration = std::min( mRushDuration + (mAmRushing ? pDT : 0.0), 0.0 + paddle_t::RUSH_DURATION );
-        mAmRushing &= mRushDuration < paddle_t::RUSH_DURATION;
-        mRushCooldown = std::max( mRushCooldown - (mAmRushing ? 0.0 : pDT), 0.0 );
+        mRushDuration = ssn::real::min( mRushDuration + (mAmRushing ? cDT : real_t(0)), cRushDuration );
+        mAmRushing &= mRushDuration < cRushDuration;
+        mRushCooldown = ssn::real::max( mRushCooldown - (mAmRushing ? real_t(0) : cDT), real_t(0) );
 
-        mVel = mAmRushing ? paddle_t::RUSH_VEL * mRushDir : mVel;
-        mAccel = mAmRushing ? vec2f32_t( 0.0f, 0.0f ) : mAccel;
+        vel() = mAmRushing ? ssn::real::tor( paddle_t::RUSH_VEL ) * mRushDir : vel();
+        accel() = mAmRushing ? vec2r_t( real_t(0), real_t(0) ) : accel();
     }
 
-    // FIXME(JRC): It would be best if this function could directly invoke
-    // 'entity_t::update' to remove any guesswork (this isn't currently possible
-    // since the velocity needs to be intercepted and capped before it's used
-    // for position update calculations).
-    { // Update Positions/Velocities //
-        mVel += static_cast<float32_t>( pDT ) * mAccel;
-        const float32_t cVelMag = glm::length( mVel );
-        if( !mAmRushing && cVelMag > paddle_t::MOVE_MAX_VEL ) {
-            mVel *= paddle_t::MOVE_MAX_VEL / cVelMag;
-        }
-        mBounds.mCenter += static_cast<float32_t>( pDT ) * mVel;
-        mBBox.mPos += static_cast<float32_t>( pDT ) * mVel;
-    }
+    // NOTE(JRC): The velocity cap is applied by 'entity_store_t::integrate',
+    // which runs between this function and 'paddle_t::resolve'.
+    maxvel() = mAmRushing ? ssn::real::infinity() : ssn::real::tor( paddle_t::MOVE_MAX_VEL );
+}
+
 
+inline void paddle_t::resolve( const float64_t pDT,
+        const vec2r_t& pContainerMin, const vec2r_t& pContainerMax ) {
     { // Resolve Container Intersections //
-        const llce::box_t& oBBox = mContainer->mBBox;
-        if( !oBBox.contains(mBBox) ) {
-            vec2f32_t containVec(
-                oBBox.xbounds().contains(mBBox.xbounds()) + 0.0f,
-                oBBox.ybounds().contains(mBBox.ybounds()) + 0.0f );
-            mVel *= containVec;
-            mAccel *= containVec;
-
-            mBBox.embed( oBBox );
-            mBounds.mCenter = mBBox.mid();
+        for( uint32_t axis = 0; axis < 2; axis++ ) {
+            const real_t cPosMin = pContainerMin[axis] + radius();
+            const real_t cPosMax = pContainerMax[axis] - radius();
+            if( pos()[axis] < cPosMin || pos()[axis] > cPosMax ) {
+                pos()[axis] = ssn::real::clamp( pos()[axis], cPosMin, cPosMax );
+                vel()[axis] = real_t( 0 );
+                accel()[axis] = real_t( 0 );
+            }
         }
     }
 }
 
 
+void paddle_t::resolve( const float64_t pDT ) {
+    resolve( pDT, ssn::real::tor(mContainer->mBBox.min()), ssn::real::tor(mContainer->mBBox.max()) );
+}
+
+
+template <stage_e S>
+void paddle_t::resolve( const float64_t pDT ) {
+    resolve( pDT, stage_container_min<S>(), stage_container_max<S>() );
+}
+
+
 void paddle_t::render() const {
     const static llce::circle_t csPaddleBounds( 0.5f, 0.5f, 1.0f );
     const static llce::circle_t csColorBounds( csPaddleBounds.mCenter, 0.90f * csPaddleBounds.mRadius );
 
     const float32_t cCooldownPercent = glm::min( 1.0f,
-        (paddle_t::RUSH_COOLDOWN - mRushCooldown) / paddle_t::RUSH_COOLDOWN );
+        (paddle_t::RUSH_COOLDOWN - ssn::real::tof(mRushCooldown)) / paddle_t::RUSH_COOLDOWN );
 
-    const color4f32_t cColorF32 = llce::gfx::color::u82f32( *mColor );
+    const color4f32_t cColorF32 = llce::gfx::color::u82f32( *color() );
     const color4f32_t cCooldownColorF32 = llce::gfx::color::saturateRGB(
         cColorF32, (cCooldownPercent >= 1.0f) ? 0.0f : -0.5f );
     const color4u8_t cCooldownColor = llce::gfx::color::f322u8( cCooldownColorF32 );
 
-    llce::gfx::render_context_t entityRC( mBBox );
-    llce::gfx::color_context_t entityCC( mColor );
+    llce::gfx::render_context_t entityRC( bbox() );
+    llce::gfx::color_context_t entityCC( color() );
 
     entityCC.update( &ssn::color::INTERFACE );
     llce::gfx::render::circle( csPaddleBounds );
@@ -167,189 +197,282 @@ void paddle_t::render() const {
 
 
 void paddle_t::move( const int32_t pDX, const int32_t pDY ) {
-    mDI.x = static_cast<float32_t>( glm::clamp(pDX, -1, 1) );
-    mDI.y = static_cast<float32_t>( glm::clamp(pDY, -1, 1) );
-    mAccel = paddle_t::MOVE_ACCEL * llce::util::normalize( mDI );
+    mDI.x = real_t( glm::clamp(pDX, -1, 1) );
+    mDI.y = real_t( glm::clamp(pDY, -1, 1) );
+    accel() = ssn::real::tor( paddle_t::MOVE_ACCEL ) * ssn::real::normalize( mDI );
 }
 
 
 void paddle_t::rush() {
-    if( !mAmRushing && mRushCooldown <= 0.0f ) {
+    if( !mAmRushing && mRushCooldown <= real_t(0) ) {
         mAmRushing = true;
-        mRushDuration = 0.0f;
-        mRushCooldown = paddle_t::RUSH_COOLDOWN;
-        mRushDir = llce::util::normalize(
-            ( glm::length(mVel) > glm::epsilon<float32_t>() ) ? mVel : mAccel );
+        mRushDuration = real_t( 0 );
+        mRushCooldown = ssn::real::tor( paddle_t::RUSH_COOLDOWN );
+        mRushDir = ssn::real::normalize(
+            ( ssn::real::length(vel()) > ssn::real::epsilon() ) ? vel() : accel() );
     }
 }
 
 /// 'ssn::puck_t' Functions ///
 
-puck_t::puck_t( const llce::circle_t& pBounds, const team::team_e& pTeam, const entity_t* pContainer ) :
-        team_entity_t( pBounds, pTeam ), mContainer( pContainer ), mWrapCount( 2, 2 )  {
-    mBBoxes[puck_t::BBOX_BASE_ID] = mBBox;
-    mWrapCounts[puck_t::BBOX_BASE_ID] = mWrapCount;
+puck_t::puck_t( entity_store_t* pStore, const llce::circle_t& pBounds, const team::team_e& pTeam, const bounds_t* pContainer ) :
+        team_entity_t( pStore, pBounds, pTeam ), mWrapCount( 2, 2 )  {
+    mContainer.set( pContainer );
 }
 
 
-void puck_t::update( const float64_t pDT ) {
-    const llce::box_t& oBBox = mContainer->mBBox;
-
-    const vec2i8_t isPrevWrap = {
-        !oBBox.xbounds().contains( mBBox.xbounds() ),
-        !oBBox.ybounds().contains( mBBox.ybounds() ) };
-    entity_t::update( pDT );
-    const vec2i8_t isCurrWrap = {
-        !oBBox.xbounds().contains( mBBox.xbounds() ),
-        !oBBox.ybounds().contains( mBBox.ybounds() ) };
+inline void puck_t::resolve( const float64_t pDT,
+        const vec2r_t& pContainerMin, const vec2r_t& pContainerMax ) {
+    // NOTE(JRC): The puck never accelerates, so its pre-integration position
+    // can be recovered exactly by stepping back along its velocity.
+    const vec2r_t cPrevPos = pos() - ssn::real::tor( pDT ) * vel();
+
+    for( uint32_t axis = 0; axis < 2; axis++ ) {
+        const real_t cMin = pContainerMin[axis], cMax = pContainerMax[axis];
+        const bool32_t cIsPrevWrap =
+            cPrevPos[axis] - radius() < cMin || cPrevPos[axis] + radius() > cMax;
+        const bool32_t cIsCurrWrap =
+            pos()[axis] - radius() < cMin || pos()[axis] + radius() > cMax;
+
+        { // Resolve Boundary Wrap //
+            mWrapCount[axis] += ( !cIsPrevWrap && cIsCurrWrap ) ?
+                ( (pos()[axis] - radius() < cMin) ? -1 : 1 ) : 0;
+            pos()[axis] = radius() +
+                ssn::real::wrap( pos()[axis] - radius(), cMin, cMax - cMin );
+        }
+    }
+}
 
-    const vec2i8_t newWrapDir = {
-        ( !isPrevWrap.x && isCurrWrap.x ) ? ( (mBBox.mPos.x < oBBox.mPos.x) ? -1 : 1 ) : 0,
-        ( !isPrevWrap.y && isCurrWrap.y ) ? ( (mBBox.mPos.y < oBBox.mPos.y) ? -1 : 1 ) : 0 };
 
-    { // Resolve Boundary Wrap //
-        mBBox.mPos.x = oBBox.xbounds().wrap( mBBox.mPos.x );
-        mBBox.mPos.y = oBBox.ybounds().wrap( mBBox.mPos.y );
-        mBounds.mCenter = mBBox.mid();
-        mWrapCount += newWrapDir;
-    }
+void puck_t::resolve( const float64_t pDT ) {
+    resolve( pDT, ssn::real::tor(mContainer->mBBox.min()), ssn::real::tor(mContainer->mBBox.max()) );
+}
 
-    { // Initialize Bounding Boxes //
-        mBBoxes[puck_t::BBOX_BASE_ID] = mBBox;
-        mWrapCounts[puck_t::BBOX_BASE_ID] = mWrapCount;
-        for( uint32_t bboxIdx = puck_t::BBOX_BASE_ID + 1; bboxIdx < puck_t::BBOX_COUNT; bboxIdx++ ) {
-            mBBoxes[bboxIdx] = llce::box_t();
-            mWrapCounts[bboxIdx] = { 0, 0 };
-        }
-    }
 
-    { // Update Bounding Boxes //
-        if( isCurrWrap.x || isCurrWrap.y ) {
-            vec2i8_t& baseWrapCount = mWrapCounts[puck_t::BBOX_BASE_ID];
-
-            if( isCurrWrap.x ) {
-                mBBoxes[puck_t::BBOX_XWRAP_ID] = llce::box_t(
-                    mBBox.min().x - oBBox.xbounds().length(), // NOTE: see wrap code above
-                    mBBoxes[puck_t::BBOX_BASE_ID].mPos.y,
-                    mBBoxes[puck_t::BBOX_BASE_ID].mDims.x,
-                    mBBoxes[puck_t::BBOX_BASE_ID].mDims.y);
-                mWrapCounts[puck_t::BBOX_XWRAP_ID] = ( mWrapCount.x > 0 ) ? mWrapCount : vec2i8_t( mWrapCount.x+1, mWrapCount.y );
-                mWrapCounts[puck_t::BBOX_BASE_ID] = ( mWrapCount.x < 0 ) ? mWrapCount : vec2i8_t( baseWrapCount.x-1, baseWrapCount.y );
-            } if( isCurrWrap.y ) {
-                mBBoxes[puck_t::BBOX_YWRAP_ID] = llce::box_t(
-                    mBBoxes[puck_t::BBOX_BASE_ID].mPos.x,
-                    mBBox.min().y - oBBox.ybounds().length(), // NOTE: see wrap code above
-                    mBBoxes[puck_t::BBOX_BASE_ID].mDims.x,
-                    mBBoxes[puck_t::BBOX_BASE_ID].mDims.y);
-                mWrapCounts[puck_t::BBOX_YWRAP_ID] = ( mWrapCount.y > 0 ) ? mWrapCount : vec2i8_t( mWrapCount.x, mWrapCount.y+1 );
-                mWrapCounts[puck_t::BBOX_BASE_ID] = ( mWrapCount.y < 0 ) ? mWrapCount : vec2i8_t( baseWrapCount.x, baseWrapCount.y-1 );
-            } if( isCurrWrap.x && isCurrWrap.y ) {
-                mBBoxes[puck_t::BBOX_XYWRAP_ID] = llce::box_t(
-                    mBBoxes[puck_t::BBOX_XWRAP_ID].mPos.x,
-                    mBBoxes[puck_t::BBOX_YWRAP_ID].mPos.y,
-                    mBBoxes[puck_t::BBOX_BASE_ID].mDims.x,
-                    mBBoxes[puck_t::BBOX_BASE_ID].mDims.y);
-                mWrapCounts[puck_t::BBOX_XYWRAP_ID] = vec2i8_t( mWrapCounts[puck_t::BBOX_XWRAP_ID].x, mWrapCounts[puck_t::BBOX_YWRAP_ID].y );
-            }
-        }
-    }
+template <stage_e S>
+void puck_t::resolve( const float64_t pDT ) {
+    resolve( pDT, stage_container_min<S>(), stage_container_max<S>() );
 }
 
 
 void puck_t::render() const {
     const static auto csRenderCursor = []
-            ( const ssn::puck_t* pPuck, const llce::box_t& pFocusBox, const uint32_t pDim ) {
+            ( const ssn::puck_t* pPuck, const vec2f32_t& pFocus, const uint32_t pAxis ) {
         const llce::box_t& boundsBox = pPuck->mContainer->mBBox; 
-        const float32_t cursorRadius = puck_t::CURSOR_RATIO * pPuck->mBounds.mRadius;
-        const color4u8_t cursorColor = *pPuck->mColor - color4u8_t{ 0x00, 0x00, 0x00, 0xaa };
+        const float32_t cursorRadius = puck_t::CURSOR_RATIO * ssn::real::tof( pPuck->radius() );
+        const color4u8_t cursorColor = *pPuck->color() - color4u8_t{ 0x00, 0x00, 0x00, 0xaa };
 
-        const llce::box_t cursorBox = ( pDim == puck_t::BBOX_XWRAP_ID ) ?
+        const llce::box_t cursorBox = ( pAxis == 0 ) ?
             llce::box_t(
-                boundsBox.min().x, pFocusBox.mid().y - cursorRadius / 2.0f,
+                boundsBox.min().x, pFocus.y - cursorRadius / 2.0f,
                 boundsBox.xbounds().length(), cursorRadius ) :
             llce::box_t(
-                pFocusBox.mid().x - cursorRadius / 2.0f, boundsBox.min().y,
+                pFocus.x - cursorRadius / 2.0f, boundsBox.min().y,
                 cursorRadius, boundsBox.ybounds().length() );
 
         llce::gfx::color_context_t cursorCC( &cursorColor );
         llce::gfx::render::box( cursorBox );
     };
 
-    csRenderCursor( this, mBBoxes[puck_t::BBOX_BASE_ID], puck_t::BBOX_XWRAP_ID );
-    csRenderCursor( this, mBBoxes[puck_t::BBOX_BASE_ID], puck_t::BBOX_YWRAP_ID );
-    if( !mBBoxes[puck_t::BBOX_XWRAP_ID].empty() ) {
-        csRenderCursor( this, mBBoxes[puck_t::BBOX_XWRAP_ID], puck_t::BBOX_YWRAP_ID );
-    } if( !mBBoxes[puck_t::BBOX_YWRAP_ID].empty() ) {
-        csRenderCursor( this, mBBoxes[puck_t::BBOX_YWRAP_ID], puck_t::BBOX_XWRAP_ID );
+    const llce::box_t cPuckBBox = bbox();
+    const vec2f32_t& cWrapDims = mContainer->mBBox.mDims;
+
+    vec2i8_t puckImages[ssn::wrap::MAX_IMAGE_COUNT];
+    const uint32_t cImageCount = ssn::wrap::images( cPuckBBox, mContainer->mBBox, puckImages );
+
+    // NOTE(JRC): Cursors span the container along an axis, so images that
+    // are only translated along that axis share the same cursor.
+    for( uint32_t imageIdx = 0; imageIdx < cImageCount; imageIdx++ ) {
+        const vec2i8_t& puckImage = puckImages[imageIdx];
+        const vec2f32_t cImageFocus = cPuckBBox.mid() + vec2f32_t( puckImage ) * cWrapDims;
+        if( puckImage.x == 0 ) {
+            csRenderCursor( this, cImageFocus, 0 );
+        } if( puckImage.y == 0 ) {
+            csRenderCursor( this, cImageFocus, 1 );
+        }
     }
 
     const static llce::circle_t csPuckBounds( 0.5f, 0.5f, 1.0f );
     const static llce::circle_t csSideBounds( csPuckBounds.mCenter, 0.875f * csPuckBounds.mRadius );
 
-    llce::gfx::color_context_t entityCC( mColor );
-    for( uint32_t bboxIdx = 0; bboxIdx < puck_t::BBOX_COUNT; bboxIdx++ ) {
-        const llce::box_t& puckBBox = mBBoxes[bboxIdx];
-        const vec2i8_t& puckWrapCount = mWrapCounts[bboxIdx];
-        if( !puckBBox.empty() ) {
-            const vec2i8_t puckTangible = tangible( puckWrapCount );
-
-            llce::gfx::render_context_t entityRC( puckBBox );
-            entityCC.update( &ssn::color::INTERFACE );
-            llce::gfx::render::circle( csPuckBounds );
-            for( int8_t side = ssn::team::left; side <= ssn::team::right; side++ ) {
-                const float32_t sideAngle = ( M_PI / 2.0f ) + ( side + 0.0f ) * M_PI;
-                const color4u8_t* sideColor = *LLCE_VECTOR_AT( puckTangible, side ) ?
-                    &ssn::color::TEAM[side] : &ssn::color::TEAM[ssn::team::neutral];
-
-                entityCC.update( sideColor );
-                llce::gfx::render::circle( csSideBounds, sideAngle, sideAngle + M_PI );
-            }
+    llce::gfx::color_context_t entityCC( color() );
+    for( uint32_t imageIdx = 0; imageIdx < cImageCount; imageIdx++ ) {
+        const vec2i8_t& puckImage = puckImages[imageIdx];
+        const llce::box_t cImageBBox( cPuckBBox.mPos + vec2f32_t(puckImage) * cWrapDims, cPuckBBox.mDims );
+        const vec2i8_t puckTangible = tangible( wrapcount(puckImage) );
+
+        llce::gfx::render_context_t entityRC( cImageBBox );
+        entityCC.update( &ssn::color::INTERFACE );
+        llce::gfx::render::circle( csPuckBounds );
+        for( int8_t side = ssn::team::left; side <= ssn::team::right; side++ ) {
+            const float32_t sideAngle = ( M_PI / 2.0f ) + ( side + 0.0f ) * M_PI;
+            const color4u8_t* sideColor = *LLCE_VECTOR_AT( puckTangible, side ) ?
+                &ssn::color::TEAM[side] : &ssn::color::TEAM[ssn::team::neutral];
+
+            entityCC.update( sideColor );
+            llce::gfx::render::circle( csSideBounds, sideAngle, sideAngle + M_PI );
         }
     }
 }
 
 
-bool32_t puck_t::hit( const team_entity_t* pSource ) {
-    for( uint32_t bboxIdx = 0; bboxIdx < puck_t::BBOX_COUNT; bboxIdx++ ) {
-        const llce::box_t& puckBBox = mBBoxes[bboxIdx];
-        const vec2i8_t& puckWrapCount = mWrapCounts[bboxIdx];
+inline bool32_t puck_t::hit( const team_entity_t* pSource, const float64_t pDT,
+        const vec2r_t& pContainerMin, const vec2r_t& pContainerMax, const vec2r_t& pContainerDims ) {
+    const real_t cDT = ssn::real::tor( pDT );
+    const vec2r_t& cSourcePos = pSource->pos();
+    const real_t cHitDist = radius() + pSource->radius();
+
+    // NOTE(JRC): Only the puck image nearest to the source can be in contact
+    // with it since the container is always wider than two hit distances.
+    vec2i8_t puckImage;
+    const vec2r_t cPuckDelta = ssn::wrap::delta( cSourcePos, pos(),
+        pContainerDims, &puckImage );
+    const vec2i8_t puckTangible = tangible(
+        wrapcount(puckImage, pContainerMin, pContainerMax) );
+    if( !*LLCE_VECTOR_AT(puckTangible, pSource->team()) ) {
+        return false;
+    }
 
-        const vec2i8_t puckTangible = tangible( puckWrapCount );
-        if( !puckBBox.empty() && *LLCE_VECTOR_AT(puckTangible, pSource->mTeam) ) {
-            llce::circle_t puckBounds( puckBBox.mid(), mBounds.mRadius );
-            if( pSource->mBounds.overlaps(puckBounds) ) {
-                puckBounds.exbed( pSource->mBounds );
+    const vec2r_t cPuckImagePos = cSourcePos + cPuckDelta;
+    const auto cExbed = [&] ( const vec2r_t& pPuckPos ) {
+        return cSourcePos + cHitDist * ssn::real::normalize( pPuckPos - cSourcePos );
+    };
 
-                vec2f32_t hitVec = puckBounds.mCenter - puckBBox.mid();
-                vec2f32_t hitDir = llce::util::normalize( hitVec );
-                // FIXME(JRC): The unnecessary multiplication here acts as
-                // a workaround to weird interactions between gcc compilation
-                // and raw 'constexpr static' variables.
-                // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=50785
-                float32_t hitMag = glm::clamp( puck_t::VEL_MULTIPLIER * glm::length(mVel),
-                    (1.0f * puck_t::MIN_VEL), (1.0f * puck_t::MAX_VEL) );
+    // NOTE(JRC): The time of impact is found by sweeping both circles
+    // back along their velocities to the start of the frame and solving
+    // |relStart + relVel * t| = hitDist for the earliest 't' in [0, dt].
+    // Contacts that exist at the start of the frame resolve by exbedding
+    // as with discrete collisions since no sweep time is available.
+    const vec2r_t cRelVel = vel() - pSource->vel();
+    const vec2r_t cRelStart = cPuckDelta - cDT * cRelVel;
+    const real_t cSweepA = ssn::real::dot( cRelVel, cRelVel );
+    const real_t cSweepB = real_t( 2 ) * ssn::real::dot( cRelStart, cRelVel );
+    const real_t cSweepC = ssn::real::dot( cRelStart, cRelStart ) - cHitDist * cHitDist;
+    const real_t cSweepD = cSweepB * cSweepB - real_t( 4 ) * cSweepA * cSweepC;
+
+    real_t hitTime = ssn::real::infinity();
+    if( cSweepC <= real_t(0) ) {
+        hitTime = real_t( 0 );
+    } else if( cSweepA > ssn::real::epsilon() && cSweepD >= real_t(0) ) {
+        hitTime = ( -cSweepB - ssn::real::sqrt(cSweepD) ) / ( real_t(2) * cSweepA );
+        hitTime = ( hitTime >= real_t(0) && hitTime <= cDT ) ? hitTime : ssn::real::infinity();
+    }
 
-                mBounds.mCenter += hitVec;
-                mBBox.mPos += hitVec;
-                mVel = hitDir * hitMag;
+    if( hitTime > cDT ) {
+        return false;
+    }
 
-                mWrapCount = { 0, 0 };
-                team_entity_t::change( static_cast<ssn::team::team_e>(pSource->mTeam) );
+    const real_t hitMag = ssn::real::clamp(
+        ssn::real::tor( puck_t::VEL_MULTIPLIER ) * ssn::real::length( vel() ),
+        ssn::real::tor( puck_t::MIN_VEL ), ssn::real::tor( puck_t::MAX_VEL ) );
+
+    vec2r_t puckHitPos = cPuckImagePos;
+    if( cSweepC <= real_t(0) ) {
+        puckHitPos = cExbed( cPuckImagePos );
+        vel() = ssn::real::normalize( puckHitPos - cPuckImagePos ) * hitMag;
+    } else {
+        const real_t cPostTime = cDT - hitTime;
+        const vec2r_t cPuckHitPos = cPuckImagePos - cPostTime * vel();
+        const vec2r_t cSourceHitPos = cSourcePos - cPostTime * pSource->vel();
+        const vec2r_t cHitDir = ssn::real::normalize( cPuckHitPos - cSourceHitPos );
+
+        vel() = cHitDir * hitMag;
+        puckHitPos = cPuckHitPos + cPostTime * vel();
+        if( ssn::real::length(puckHitPos - cSourcePos) < cHitDist ) {
+            puckHitPos = cExbed( puckHitPos );
+        }
+    }
 
-                return true;
-            }
+    pos() += puckHitPos - cPuckImagePos;
+
+    mWrapCount = { 0, 0 };
+    team_entity_t::change( static_cast<ssn::team::team_e>(pSource->team()) );
+
+    return true;
+}
+
+
+bool32_t puck_t::hit( const team_entity_t* pSource, const float64_t pDT ) {
+    return hit( pSource, pDT,
+        ssn::real::tor(mContainer->mBBox.min()), ssn::real::tor(mContainer->mBBox.max()),
+        ssn::real::tor(mContainer->mBBox.mDims) );
+}
+
+
+template <stage_e S>
+bool32_t puck_t::hit( const team_entity_t* pSource, const float64_t pDT ) {
+    return hit( pSource, pDT,
+        stage_container_min<S>(), stage_container_max<S>(), stage_container_dims<S>() );
+}
+
+
+inline vec2i8_t puck_t::wrapcount( const vec2i8_t& pImage,
+        const vec2r_t& pContainerMin, const vec2r_t& pContainerMax ) const {
+    return puck_t::wrapcount( mWrapCount, pos(), radius(), pImage, pContainerMin, pContainerMax );
+}
+
+
+vec2i8_t puck_t::wrapcount( const vec2i8_t& pImage ) const {
+    return wrapcount( pImage,
+        ssn::real::tor(mContainer->mBBox.min()), ssn::real::tor(mContainer->mBBox.max()) );
+}
+
+
+vec2i8_t puck_t::wrapcount( const vec2i8_t& pWrapCount, const vec2r_t& pPos, const real_t pRadius,
+        const vec2i8_t& pImage, const vec2r_t& pContainerMin, const vec2r_t& pContainerMax ) {
+    // NOTE(JRC): While the puck straddles a boundary, the image emerging on
+    // the far side keeps the wrap count and the image still leaving the
+    // container is one wrap behind (see 'puck_t::resolve').
+    vec2i8_t imageWrapCount = pWrapCount;
+    for( uint32_t axis = 0; axis < 2; axis++ ) {
+        const bool32_t cIsStraddling =
+            pPos[axis] + pRadius > pContainerMax[axis] ||
+            pPos[axis] - pRadius < pContainerMin[axis];
+        if( cIsStraddling ) {
+            const int8_t cWrapCount = pWrapCount[axis];
+            imageWrapCount[axis] = ( pImage[axis] != 0 ) ?
+                ( (cWrapCount > 0) ? cWrapCount : cWrapCount + 1 ) :
+                ( (cWrapCount < 0) ? cWrapCount : cWrapCount - 1 );
         }
     }
 
-    return false;
+    return imageWrapCount;
 }
 
+
 vec2i8_t puck_t::tangible( const vec2i8_t& pWrapCount ) const {
+    return puck_t::tangible( team(), pWrapCount );
+}
+
+
+vec2i8_t puck_t::tangible( const uint8_t pTeam, const vec2i8_t& pWrapCount ) {
     const uint32_t cWrapNumber = std::max( std::abs(pWrapCount.x), std::abs(pWrapCount.y) );
     return vec2i8_t(
-        (bool8_t)(cWrapNumber >= (1 + (int8_t)(mTeam == ssn::team::left))),
-        (bool8_t)(cWrapNumber >= (1 + (int8_t)(mTeam == ssn::team::right))) );
+        (bool8_t)(cWrapNumber >= (1 + (int8_t)(pTeam == ssn::team::left))),
+        (bool8_t)(cWrapNumber >= (1 + (int8_t)(pTeam == ssn::team::right))) );
 }
 
+/// Explicit Instantiations ///
+
+static_assert( ssn::stage::_length == 4,
+    "Incorrect number of stage kernel instantiations; "
+    "please instantiate the stage-specialized 'ssn::paddle_t'/'ssn::puck_t' "
+    "functions for all stages in enumeration 'ssn::stage::stage_e'." );
+
+template void paddle_t::resolve<ssn::stage::box>( const float64_t );
+template void paddle_t::resolve<ssn::stage::vert>( const float64_t );
+template void paddle_t::resolve<ssn::stage::horz>( const float64_t );
+template void paddle_t::resolve<ssn::stage::wild>( const float64_t );
+
+template void puck_t::resolve<ssn::stage::box>( const float64_t );
+template void puck_t::resolve<ssn::stage::vert>( const float64_t );
+template void puck_t::resolve<ssn::stage::horz>( const float64_t );
+template void puck_t::resolve<ssn::stage::wild>( const float64_t );
+
+template bool32_t puck_t::hit<ssn::stage::box>( const team_entity_t*, const float64_t );
+template bool32_t puck_t::hit<ssn::stage::vert>( const team_entity_t*, const float64_t );
+template bool32_t puck_t::hit<ssn::stage::horz>( const team_entity_t*, const float64_t );
+template bool32_t puck_t::hit<ssn::stage::wild>( const team_entity_t*, const float64_t );
+
 
 }
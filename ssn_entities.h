@@ -17,22 +17,15 @@ class team_entity_t : public entity_t {
 
     /// Constructors ///
 
-    team_entity_t( const llce::box_t& pBBox, const team::team_e& pTeam );
-    team_entity_t( const llce::circle_t& pBounds, const team::team_e& pTeam );
+    team_entity_t( entity_store_t* pStore, const llce::circle_t& pBounds, const team::team_e& pTeam );
 
     /// Class Functions ///
 
     void change( const team::team_e& pTeam );
-
-    /// Class Fields ///
-
-    public:
-
-    uint8_t mTeam;
 };
 
 
-class bounds_t : public entity_t {
+class bounds_t {
     public:
 
     /// Class Attributes ///
@@ -56,12 +49,17 @@ class bounds_t : public entity_t {
 
     public:
 
+    llce::box_t mBBox; // units: world
+
     vec2f32_t mCurrAreaCorners[AREA_CORNER_COUNT];
     uint8_t mCurrAreaTeam;
     uint32_t mCurrAreaCount;
+    uint32_t mAreaCount;
+
+    // NOTE(JRC): The area history is only touched when an area is claimed and
+    // by rendering/scoring, so it's kept after the fields read every tick.
     vec2f32_t mAreaCorners[AREA_MAX_COUNT * AREA_CORNER_COUNT];
     uint8_t mAreaTeams[AREA_MAX_COUNT];
-    uint32_t mAreaCount;
 };
 
 
@@ -79,26 +77,34 @@ class paddle_t : public team_entity_t {
 
     /// Constructors ///
 
-    paddle_t( const llce::circle_t& pBounds, const team::team_e& pTeam, const entity_t* pContainer );
+    paddle_t( entity_store_t* pStore, const llce::circle_t& pBounds, const team::team_e& pTeam, const bounds_t* pContainer );
 
     /// Class Functions ///
 
     void update( const float64_t pDT );
+    void resolve( const float64_t pDT );
+    template <stage_e S> void resolve( const float64_t pDT );
     void render() const;
 
     void move( const int32_t pDX, const int32_t pDY );
     void rush();
 
+    /// Helper Functions ///
+
+    private:
+
+    void resolve( const float64_t pDT, const vec2r_t& pContainerMin, const vec2r_t& pContainerMax );
+
     /// Class Fields ///
 
     public:
 
-    const entity_t* mContainer;
-    vec2f32_t mDI;
+    rel_ptr_t<const bounds_t> mContainer;
+    vec2r_t mDI;
     bool32_t mAmRushing;
-    vec2f32_t mRushDir;
-    float32_t mRushDuration;
-    float32_t mRushCooldown;
+    vec2r_t mRushDir;
+    real_t mRushDuration;
+    real_t mRushCooldown;
 };
 
 
@@ -107,9 +113,6 @@ class puck_t : public team_entity_t {
 
     /// Class Attributes ///
 
-    constexpr static uint32_t BBOX_COUNT = 4;
-    constexpr static uint32_t BBOX_BASE_ID = 0, BBOX_XWRAP_ID = 1, BBOX_YWRAP_ID = 2, BBOX_XYWRAP_ID = 3;
-
     constexpr static float32_t MAX_VEL = 5.0e0f;        // units: world / second
     constexpr static float32_t MIN_VEL = 5.0e-1f;       // units: world / second
     constexpr static float32_t VEL_MULTIPLIER = 1.1f;   // units: new velocity / old velocity
@@ -118,25 +121,42 @@ class puck_t : public team_entity_t {
 
     /// Constructors ///
 
-    puck_t( const llce::circle_t& pBounds, const team::team_e& pTeam, const entity_t* pContainer );
+    puck_t( entity_store_t* pStore, const llce::circle_t& pBounds, const team::team_e& pTeam, const bounds_t* pContainer );
 
     /// Class Functions ///
 
-    void update( const float64_t pDT );
+    void resolve( const float64_t pDT );
+    template <stage_e S> void resolve( const float64_t pDT );
     void render() const;
 
-    bool32_t hit( const team_entity_t* pSource );
+    bool32_t hit( const team_entity_t* pSource, const float64_t pDT );
+    template <stage_e S> bool32_t hit( const team_entity_t* pSource, const float64_t pDT );
 
     vec2i8_t tangible( const vec2i8_t& pWrapCount ) const;
+    static vec2i8_t tangible( const uint8_t pTeam, const vec2i8_t& pWrapCount );
+    vec2i8_t wrapcount( const vec2i8_t& pImage ) const;
+    static vec2i8_t wrapcount( const vec2i8_t& pWrapCount, const vec2r_t& pPos, const real_t pRadius,
+        const vec2i8_t& pImage, const vec2r_t& pContainerMin, const vec2r_t& pContainerMax );
+
+    /// Helper Functions ///
+
+    // NOTE(JRC): These kernels take the container bounds as arguments so that
+    // the stage-specialized functions above can fold them as constants.
+
+    private:
+
+    void resolve( const float64_t pDT, const vec2r_t& pContainerMin, const vec2r_t& pContainerMax );
+    bool32_t hit( const team_entity_t* pSource, const float64_t pDT,
+        const vec2r_t& pContainerMin, const vec2r_t& pContainerMax, const vec2r_t& pContainerDims );
+    vec2i8_t wrapcount( const vec2i8_t& pImage,
+        const vec2r_t& pContainerMin, const vec2r_t& pContainerMax ) const;
 
     /// Class Fields ///
 
     public:
 
-    const entity_t* mContainer;
+    rel_ptr_t<const bounds_t> mContainer;
     vec2i8_t mWrapCount;
-    llce::box_t mBBoxes[BBOX_COUNT];
-    vec2i8_t mWrapCounts[BBOX_COUNT];
 };
 
 }
@@ -0,0 +1,122 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <glm/geometric.hpp>
+
+#include "ssn_entity_store_t.h"
+
+namespace ssn {
+
+/// Class Functions ///
+
+entity_store_t::entity_store_t() {
+    clear();
+}
+
+
+void entity_store_t::clear() {
+    std::memset( this, 0, sizeof(entity_store_t) );
+}
+
+
+uint32_t entity_store_t::alloc( const llce::circle_t& pBounds, const uint8_t pTeam ) {
+    LLCE_CHECK_WARNING( mCount < entity_store_t::MAX_ENTITY_COUNT,
+        "Couldn't allocate entity due to insufficient space; " <<
+        "all " << entity_store_t::MAX_ENTITY_COUNT << " entity slots are in use." );
+    if( mCount >= entity_store_t::MAX_ENTITY_COUNT ) {
+        return entity_store_t::INVALID_ID;
+    }
+
+    const uint32_t cEntityID = mCount++;
+    mPoss[cEntityID] = ssn::real::tor( pBounds.mCenter );
+    mVels[cEntityID] = vec2r_t( real_t(0), real_t(0) );
+    mAccels[cEntityID] = vec2r_t( real_t(0), real_t(0) );
+    mMaxVels[cEntityID] = ssn::real::infinity();
+    mRadii[cEntityID] = ssn::real::tor( pBounds.mRadius );
+    mTeams[cEntityID] = pTeam;
+    return cEntityID;
+}
+
+
+void entity_store_t::integrate( const float64_t pDT ) {
+#if SSN_FIXED_POINT
+    // NOTE(JRC): Fixed-point values need 64-bit intermediate products, which
+    // SSE2 lacks for packed 32-bit lanes, so this path is a flat integer loop;
+    // an infinite cap is skipped since its square overflows the format.
+    const real_t cDT = ssn::real::tor( pDT );
+    const real_t cInfinity = ssn::real::infinity();
+    for( uint32_t entityIdx = 0; entityIdx < mCount; entityIdx++ ) {
+        vec2r_t& vel = mVels[entityIdx];
+        vel += cDT * mAccels[entityIdx];
+
+        const real_t cMaxVel = mMaxVels[entityIdx];
+        const real_t cVelMagSq = ssn::real::dot( vel, vel );
+        if( cMaxVel != cInfinity && cVelMagSq > cMaxVel * cMaxVel ) {
+            vel *= cMaxVel / ssn::real::sqrt( cVelMagSq );
+        }
+
+        mPoss[entityIdx] += cDT * vel;
+    }
+#else
+    const float32_t cDT = static_cast<float32_t>( pDT );
+
+    float32_t* const poss = &mPoss[0].x;
+    float32_t* const vels = &mVels[0].x;
+    const float32_t* const accels = &mAccels[0].x;
+
+    // NOTE(JRC): The SIMD path processes entities in pairs (i.e. 4 components
+    // at a time), which may touch the one unallocated slot past 'mCount';
+    // this is harmless since 'MAX_ENTITY_COUNT' is even and unused slots are
+    // zeroed by 'clear'.
+    static_assert( entity_store_t::MAX_ENTITY_COUNT % 2 == 0,
+        "Invalid entity capacity; 'ssn::entity_store_t::MAX_ENTITY_COUNT' must be "
+        "a multiple of 2 to support paired SIMD integration." );
+
+#if defined(__SSE2__)
+    const __m128 cDTs = _mm_set1_ps( cDT );
+    const uint32_t cPairCount = ( mCount + 1 ) / 2;
+    for( uint32_t pairIdx = 0; pairIdx < cPairCount; pairIdx++ ) {
+        const uint32_t cCompIdx = 4 * pairIdx;
+        __m128 vel = _mm_add_ps( _mm_loadu_ps(&vels[cCompIdx]),
+            _mm_mul_ps(cDTs, _mm_loadu_ps(&accels[cCompIdx])) );
+
+        // Velocity Capping: (vx0 vy0 vx1 vy1) => (|v0|^2 |v0|^2 |v1|^2 |v1|^2) //
+        const __m128 cVelSqs = _mm_mul_ps( vel, vel );
+        const __m128 cVelMagSqs = _mm_add_ps( cVelSqs,
+            _mm_shuffle_ps(cVelSqs, cVelSqs, _MM_SHUFFLE(2, 3, 0, 1)) );
+        const __m128 cMaxVels = _mm_set_ps(
+            mMaxVels[2 * pairIdx + 1], mMaxVels[2 * pairIdx + 1],
+            mMaxVels[2 * pairIdx + 0], mMaxVels[2 * pairIdx + 0] );
+        const __m128 cCapMask = _mm_cmpgt_ps( cVelMagSqs, _mm_mul_ps(cMaxVels, cMaxVels) );
+        const __m128 cCapVel = _mm_mul_ps( vel,
+            _mm_div_ps(cMaxVels, _mm_sqrt_ps(cVelMagSqs)) );
+        vel = _mm_or_ps( _mm_and_ps(cCapMask, cCapVel), _mm_andnot_ps(cCapMask, vel) );
+
+        _mm_storeu_ps( &vels[cCompIdx], vel );
+        _mm_storeu_ps( &poss[cCompIdx], _mm_add_ps(_mm_loadu_ps(&poss[cCompIdx]),
+            _mm_mul_ps(cDTs, vel)) );
+    }
+#else
+    const uint32_t cCompCount = 2 * mCount;
+    for( uint32_t compIdx = 0; compIdx < cCompCount; compIdx++ ) {
+        vels[compIdx] += cDT * accels[compIdx];
+    }
+    for( uint32_t entityIdx = 0; entityIdx < mCount; entityIdx++ ) {
+        const float32_t cVelMagSq = glm::dot( mVels[entityIdx], mVels[entityIdx] );
+        const float32_t cMaxVel = mMaxVels[entityIdx];
+        mVels[entityIdx] *= ( cVelMagSq > cMaxVel * cMaxVel ) ?
+            cMaxVel / std::sqrt( cVelMagSq ) : 1.0f;
+    }
+    for( uint32_t compIdx = 0; compIdx < cCompCount; compIdx++ ) {
+        poss[compIdx] += cDT * vels[compIdx];
+    }
+#endif
+#endif
+}
+
+}
@@ -0,0 +1,48 @@
+#ifndef SSN_ENTITY_STORE_T_H
+#define SSN_ENTITY_STORE_T_H
+
+#include "circle_t.h"
+
+#include "ssn_real.hpp"
+#include "consts.h"
+
+namespace ssn {
+
+class entity_store_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t MAX_ENTITY_COUNT = 192;
+    constexpr static uint32_t INVALID_ID = MAX_ENTITY_COUNT;
+
+    /// Constructors ///
+
+    entity_store_t();
+
+    /// Class Functions ///
+
+    void clear();
+    uint32_t alloc( const llce::circle_t& pBounds, const uint8_t pTeam );
+
+    void integrate( const float64_t pDT );
+
+    /// Class Fields ///
+
+    public:
+
+    // NOTE(JRC): Each field is stored in its own contiguous array so that the
+    // integration pass can stream through the kinematic fields of all entities
+    // at once; the vector fields are interleaved as (x0, y0, x1, y1, ...).
+    alignas(16) vec2r_t mPoss[MAX_ENTITY_COUNT];   // units: world
+    alignas(16) vec2r_t mVels[MAX_ENTITY_COUNT];   // units: world / second
+    alignas(16) vec2r_t mAccels[MAX_ENTITY_COUNT]; // units: world / second**2
+    alignas(16) real_t mMaxVels[MAX_ENTITY_COUNT]; // units: world / second
+    alignas(16) real_t mRadii[MAX_ENTITY_COUNT];   // units: world
+    uint8_t mTeams[MAX_ENTITY_COUNT];
+    uint32_t mCount;
+};
+
+}
+
+#endif
@@ -12,30 +12,27 @@ namespace ssn {
 
 /// Class Functions ///
 
-entity_t::entity_t( const llce::box_t& pBBox, const color4u8_t* pColor ) :
-        mBounds( pBBox.mid(), std::max(pBBox.mDims.x, pBBox.mDims.y) ), mBBox( pBBox ),
-        mVel( 0.0f, 0.0f ), mAccel( 0.0f, 0.0f ), mColor( pColor ) {
-    
+entity_t::entity_t( entity_store_t* pStore, const llce::circle_t& pBounds, const uint8_t pTeam ) :
+        mID( pStore->alloc(pBounds, pTeam) ) {
+    mStore.set( pStore );
 }
 
-entity_t::entity_t( const llce::circle_t& pBounds, const color4u8_t* pColor ) :
-        mBounds( pBounds ), mBBox( pBounds.mCenter, 2.0f * pBounds.mRadius * vec2f32_t(1.0f, 1.0f), llce::geom::anchor2D::mm ),
-        mVel( 0.0f, 0.0f ), mAccel( 0.0f, 0.0f ), mColor( pColor ) {
-    
+
+void entity_t::render() const {
+    llce::gfx::render_context_t entityRC( bbox() );
+    llce::gfx::color_context_t entityCC( color() );
+    llce::gfx::render::circle( llce::circle_t(vec2f32_t(0.5f, 0.5f), 1.0f) );
 }
 
 
-void entity_t::update( const float64_t pDT ) {
-    mVel += static_cast<float32_t>( pDT ) * mAccel;
-    mBounds.mCenter += static_cast<float32_t>( pDT ) * mVel;
-    mBBox.mPos += static_cast<float32_t>( pDT ) * mVel;
+llce::circle_t entity_t::bounds() const {
+    return llce::circle_t( ssn::real::tof(pos()), ssn::real::tof(radius()) );
 }
 
 
-void entity_t::render() const {
-    llce::gfx::render_context_t entityRC( mBBox );
-    llce::gfx::color_context_t entityCC( mColor );
-    llce::gfx::render::circle( llce::circle_t(vec2f32_t(0.5f, 0.5f), 1.0f) );
+llce::box_t entity_t::bbox() const {
+    const llce::circle_t cBounds = bounds();
+    return llce::box_t( cBounds.mCenter, 2.0f * cBounds.mRadius * vec2f32_t(1.0f, 1.0f), llce::geom::anchor2D::mm );
 }
 
 }
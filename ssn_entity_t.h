@@ -4,6 +4,8 @@
 #include "box_t.h"
 #include "circle_t.h"
 
+#include "ssn_entity_store_t.h"
+#include "ssn_rel_ptr_t.hpp"
 #include "ssn_data.h"
 #include "consts.h"
 
@@ -14,23 +16,40 @@ class entity_t {
 
     /// Constructors ///
 
-    entity_t( const llce::box_t& pBBox, const color4u8_t* pColor );
-    entity_t( const llce::circle_t& pBounds, const color4u8_t* pColor );
+    entity_t( entity_store_t* pStore, const llce::circle_t& pBounds, const uint8_t pTeam );
 
     /// Class Functions ///
 
-    void update( const float64_t pDT );
     void render() const;
 
+    llce::circle_t bounds() const;
+    llce::box_t bbox() const;
+
+    /// Store Accessors ///
+
+    vec2r_t& pos() { return mStore->mPoss[mID]; }
+    const vec2r_t& pos() const { return mStore->mPoss[mID]; }
+    vec2r_t& vel() { return mStore->mVels[mID]; }
+    const vec2r_t& vel() const { return mStore->mVels[mID]; }
+    vec2r_t& accel() { return mStore->mAccels[mID]; }
+    const vec2r_t& accel() const { return mStore->mAccels[mID]; }
+    real_t& maxvel() { return mStore->mMaxVels[mID]; }
+    real_t radius() const { return mStore->mRadii[mID]; }
+    uint8_t& team() { return mStore->mTeams[mID]; }
+    uint8_t team() const { return mStore->mTeams[mID]; }
+
+    const color4u8_t* color() const { return &ssn::color::TEAM[team()]; }
+
     /// Class Fields ///
 
     public:
 
-    llce::circle_t mBounds; // units: world
-    llce::box_t mBBox; // units: world
-    vec2f32_t mVel; // units: world / second
-    vec2f32_t mAccel; // units: world / second**2
-    const color4u8_t* mColor; // units: (r,g,b,a)
+    // NOTE(JRC): All kinematic state lives in the shared 'entity_store_t' so
+    // that it can be integrated for all entities in a single pass; bounding
+    // boxes are derived from the store rather than being kept in sync.
+    // Entities must be constructed in place since 'mStore' is self-relative.
+    rel_ptr_t<entity_store_t> mStore;
+    uint32_t mID;
 };
 
 }
@@ -0,0 +1,283 @@
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rng_t.h"
+
+#include "ssn_modes.h"
+#include "ssn_env.h"
+
+/// Internal Types ///
+
+// NOTE(JRC): Games are allocated as raw blocks (like 'ssn::runner_t' matches)
+// since 'ssn::state_t' is initialized in-place, and each is padded to its own
+// cache lines so that workers never share lines.
+struct alignas(64) ssn_env_game_t {
+    ssn::state_t state;
+    uint64_t resets;   // units: rounds started
+    uint16_t prevDown; // units: 'ssn::actions_t::down' of the previous step
+};
+
+struct ssn_env {
+    ssn_env_game_t* games;
+    uint32_t count;
+    uint32_t observationSize; // units: floats per game
+
+    ssn::stage_e stage;
+    ssn::format_e format;
+    float64_t dt;
+    uint64_t seed;
+
+    float32_t* observations;
+    float32_t* rewards;
+    uint8_t* dones;
+    const uint16_t* actions; // units: actions of the current step
+
+    std::vector<std::thread> workers;
+    std::mutex poolMutex;
+    std::condition_variable poolStartCV, poolDoneCV;
+    uint64_t poolGeneration;
+    uint32_t poolActiveCount;
+    bool32_t poolExiting;
+};
+
+/// Helper Functions ///
+
+static void ssn_env_observe( const ssn_env_t* pEnv, const uint32_t pGameIdx ) {
+    const ssn::state_t* const state = &pEnv->games[pGameIdx].state;
+    float32_t* observation = &pEnv->observations[pGameIdx * pEnv->observationSize];
+
+    for( uint32_t puckIdx = 0; puckIdx < state->puckCount; puckIdx++ ) {
+        const ssn::puck_t& puck = state->pucks[puckIdx];
+        *observation++ = ssn::real::tof( puck.pos().x );
+        *observation++ = ssn::real::tof( puck.pos().y );
+        *observation++ = ssn::real::tof( puck.vel().x );
+        *observation++ = ssn::real::tof( puck.vel().y );
+        *observation++ = static_cast<float32_t>( puck.mWrapCount.x );
+        *observation++ = static_cast<float32_t>( puck.mWrapCount.y );
+        *observation++ = static_cast<float32_t>( puck.team() );
+    }
+
+    // NOTE(JRC): Puck grid cells that spawn on top of paddles are left empty
+    // (see 'ssn::mode::game::init'), so the remaining puck slots are zeroed
+    // to keep the paddle fields at the same offsets for every stage.
+    const vec2u32_t cPuckGrid = ssn::FORMAT_PUCK_GRIDS[pEnv->format];
+    const uint32_t cPuckSlotCount = cPuckGrid.x * cPuckGrid.y - state->puckCount;
+    std::memset( observation, 0, 7 * cPuckSlotCount * sizeof(float32_t) );
+    observation += 7 * cPuckSlotCount;
+
+    for( uint32_t paddleIdx = 0; paddleIdx < state->paddleCount; paddleIdx++ ) {
+        const ssn::paddle_t& paddle = state->paddles[paddleIdx];
+        *observation++ = ssn::real::tof( paddle.pos().x );
+        *observation++ = ssn::real::tof( paddle.pos().y );
+        *observation++ = ssn::real::tof( paddle.vel().x );
+        *observation++ = ssn::real::tof( paddle.vel().y );
+        *observation++ = paddle.mAmRushing ? 1.0f : 0.0f;
+        *observation++ = ssn::real::tof( paddle.mRushCooldown );
+    }
+
+    const ssn::bounds_t& bounds = state->bounds;
+    *observation++ = static_cast<float32_t>( bounds.mCurrAreaTeam );
+    *observation++ = static_cast<float32_t>( bounds.mCurrAreaCount );
+    for( uint32_t cornerIdx = 0; cornerIdx < ssn::bounds_t::AREA_CORNER_COUNT; cornerIdx++ ) {
+        const bool32_t cIsClaimed = cornerIdx < bounds.mCurrAreaCount;
+        *observation++ = cIsClaimed ? bounds.mCurrAreaCorners[cornerIdx].x : 0.0f;
+        *observation++ = cIsClaimed ? bounds.mCurrAreaCorners[cornerIdx].y : 0.0f;
+    }
+
+    *observation++ = static_cast<float32_t>( state->rt );
+}
+
+
+static void ssn_env_restart( ssn_env_t* pEnv, const uint32_t pGameIdx ) {
+    ssn_env_game_t* const game = &pEnv->games[pGameIdx];
+    ssn::state_t* const state = &game->state;
+
+    state->rng = llce::rng_t( pEnv->seed + pEnv->count * game->resets++ + pGameIdx );
+    state->mode = state->pmode = ssn::mode::game::ID;
+    state->sid = pEnv->stage;
+    state->fid = pEnv->format;
+    state->dt = pEnv->dt;
+    state->tt = state->st = 0.0;
+    ssn::mode::game::init( state, nullptr );
+    game->prevDown = 0;
+}
+
+
+static void ssn_env_advance( ssn_env_t* pEnv, const uint32_t pGameIdx ) {
+    ssn_env_game_t* const game = &pEnv->games[pGameIdx];
+    ssn::state_t* const state = &game->state;
+
+    const uint16_t cDown = pEnv->actions[pGameIdx];
+    const ssn::actions_t cActions = { cDown, static_cast<uint16_t>(cDown & ~game->prevDown) };
+    game->prevDown = cDown;
+
+    const uint32_t cPrevAreaCount = state->bounds.mAreaCount;
+    ssn::mode::game::step( state, cActions, pEnv->dt );
+    state->tt += pEnv->dt;
+    state->st += pEnv->dt;
+
+    float32_t reward = 0.0f;
+    for( uint32_t areaIdx = cPrevAreaCount; areaIdx < state->bounds.mAreaCount; areaIdx++ ) {
+        const uint8_t cAreaTeam = state->bounds.mAreaTeams[areaIdx];
+        reward += ( cAreaTeam == ssn::team::left ) ? 1.0f : ( (cAreaTeam == ssn::team::right) ? -1.0f : 0.0f );
+    }
+    pEnv->rewards[pGameIdx] = reward;
+
+    const bool32_t cIsDone = state->pmode != ssn::mode::game::ID;
+    pEnv->dones[pGameIdx] = cIsDone ? 1 : 0;
+    if( cIsDone ) {
+        ssn_env_restart( pEnv, pGameIdx );
+    }
+
+    ssn_env_observe( pEnv, pGameIdx );
+}
+
+
+static void ssn_env_work( ssn_env_t* pEnv, const uint32_t pWorkerIdx ) {
+    const uint32_t cWorkerCount = static_cast<uint32_t>( pEnv->workers.size() ) + 1;
+    const uint32_t cGameStart = static_cast<uint32_t>( (pEnv->count * (pWorkerIdx + 0ull)) / cWorkerCount );
+    const uint32_t cGameEnd = static_cast<uint32_t>( (pEnv->count * (pWorkerIdx + 1ull)) / cWorkerCount );
+    for( uint32_t gameIdx = cGameStart; gameIdx < cGameEnd; gameIdx++ ) {
+        ssn_env_advance( pEnv, gameIdx );
+    }
+}
+
+
+static void ssn_env_serve( ssn_env_t* pEnv, const uint32_t pWorkerIdx ) {
+    uint64_t workerGeneration = 0;
+
+    while( true ) {
+        {
+            std::unique_lock<std::mutex> poolLock( pEnv->poolMutex );
+            pEnv->poolStartCV.wait( poolLock, [pEnv, workerGeneration]
+                { return pEnv->poolExiting || pEnv->poolGeneration != workerGeneration; } );
+            if( pEnv->poolExiting ) { return; }
+            workerGeneration = pEnv->poolGeneration;
+        }
+
+        ssn_env_work( pEnv, pWorkerIdx );
+
+        {
+            std::lock_guard<std::mutex> poolLock( pEnv->poolMutex );
+            if( --pEnv->poolActiveCount == 0 ) {
+                pEnv->poolDoneCV.notify_one();
+            }
+        }
+    }
+}
+
+/// Functions ///
+
+extern "C" ssn_env_t* ssn_env_create( uint32_t pCount, uint32_t pStage, uint32_t pFormat,
+        double pDT, uint64_t pSeed, uint32_t pThreads,
+        float* pObservations, float* pRewards, uint8_t* pDones ) {
+    LLCE_CHECK_WARNING( pCount > 0 && pStage < ssn::stage::_length && pFormat < ssn::format::_length,
+        "Couldn't create environment; invalid count (" << pCount << "), stage (" <<
+        pStage << ") or format (" << pFormat << ")." );
+    if( pCount == 0 || pStage >= ssn::stage::_length || pFormat >= ssn::format::_length ) {
+        return nullptr;
+    }
+
+    ssn_env_t* env = new ssn_env_t();
+    env->count = pCount;
+    env->stage = static_cast<ssn::stage_e>( pStage );
+    env->format = static_cast<ssn::format_e>( pFormat );
+    env->dt = pDT;
+    env->seed = pSeed;
+    env->observations = pObservations;
+    env->rewards = pRewards;
+    env->dones = pDones;
+    env->actions = nullptr;
+    env->poolGeneration = 0;
+    env->poolActiveCount = 0;
+    env->poolExiting = false;
+
+    env->games = static_cast<ssn_env_game_t*>( std::aligned_alloc(
+        alignof(ssn_env_game_t), pCount * sizeof(ssn_env_game_t)) );
+    std::memset( static_cast<void*>(env->games), 0, pCount * sizeof(ssn_env_game_t) );
+
+    { // Calculate Observation Size //
+        const vec2u32_t cPuckGrid = ssn::FORMAT_PUCK_GRIDS[env->format];
+        const vec2u32_t cPaddleGrid = ssn::FORMAT_PADDLE_GRIDS[env->format];
+        const uint32_t cPuckCount = cPuckGrid.x * cPuckGrid.y;
+        const uint32_t cPaddleCount = 2 * cPaddleGrid.x * cPaddleGrid.y;
+        env->observationSize = 7 * cPuckCount + 6 * cPaddleCount +
+            2 + 2 * ssn::bounds_t::AREA_CORNER_COUNT + 1;
+    }
+
+    // NOTE(JRC): The calling thread always steps the first share of games, so
+    // only 'threads - 1' workers are spawned.
+    const uint32_t cThreadCount = std::min( pCount, ( pThreads != 0 ) ? pThreads :
+        std::max(std::thread::hardware_concurrency(), 1u) );
+    env->workers.reserve( cThreadCount - 1 );
+    for( uint32_t workerIdx = 1; workerIdx < cThreadCount; workerIdx++ ) {
+        env->workers.emplace_back( ssn_env_serve, env, workerIdx );
+    }
+
+    ssn_env_reset( env );
+    return env;
+}
+
+
+extern "C" void ssn_env_destroy( ssn_env_t* pEnv ) {
+    if( pEnv == nullptr ) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> poolLock( pEnv->poolMutex );
+        pEnv->poolExiting = true;
+    }
+    pEnv->poolStartCV.notify_all();
+    for( std::thread& worker : pEnv->workers ) {
+        worker.join();
+    }
+
+    std::free( pEnv->games );
+    delete pEnv;
+}
+
+
+extern "C" uint32_t ssn_env_count( const ssn_env_t* pEnv ) {
+    return pEnv->count;
+}
+
+
+extern "C" uint32_t ssn_env_observation_size( const ssn_env_t* pEnv ) {
+    return pEnv->observationSize;
+}
+
+
+extern "C" void ssn_env_reset( ssn_env_t* pEnv ) {
+    for( uint32_t gameIdx = 0; gameIdx < pEnv->count; gameIdx++ ) {
+        ssn_env_restart( pEnv, gameIdx );
+        ssn_env_observe( pEnv, gameIdx );
+        pEnv->rewards[gameIdx] = 0.0f;
+        pEnv->dones[gameIdx] = 0;
+    }
+}
+
+
+extern "C" void ssn_env_step( ssn_env_t* pEnv, const uint16_t* pActions ) {
+    pEnv->actions = pActions;
+
+    if( !pEnv->workers.empty() ) {
+        std::lock_guard<std::mutex> poolLock( pEnv->poolMutex );
+        pEnv->poolActiveCount = static_cast<uint32_t>( pEnv->workers.size() );
+        pEnv->poolGeneration++;
+    }
+    pEnv->poolStartCV.notify_all();
+
+    ssn_env_work( pEnv, 0 );
+
+    {
+        std::unique_lock<std::mutex> poolLock( pEnv->poolMutex );
+        pEnv->poolDoneCV.wait( poolLock, [pEnv] { return pEnv->poolActiveCount == 0; } );
+    }
+    pEnv->actions = nullptr;
+}
@@ -0,0 +1,50 @@
+#ifndef SSN_ENV_H
+#define SSN_ENV_H
+
+#include <stdint.h>
+
+// NOTE(JRC): A C ABI for stepping many independent headless 'ssn::mode::game'
+// rounds at once (e.g. for training agents through 'ctypes'/'cffi'). All of
+// the outputs are written directly into caller-owned buffers that are bound
+// at creation time, so no data is copied across the boundary per step:
+//
+//   observations: 'count * ssn_env_observation_size()' floats, where each
+//     environment's observation is laid out as (in order):
+//       per puck:   pos.x, pos.y, vel.x, vel.y, wraps.x, wraps.y, team
+//                   (zeroed for the format's puck slots left empty at spawn)
+//       per paddle: pos.x, pos.y, vel.x, vel.y, rushing, rush cooldown
+//       claim:      current area team, current area corner count,
+//                   3 x (corner.x, corner.y)
+//       round:      round time (seconds)
+//   rewards:      'count' floats; the change in (left areas - right areas)
+//     claimed during the step (i.e. from the left team's perspective)
+//   dones:        'count' bytes; 1 if the round ended during the step, in
+//     which case the environment has already been reset and its observation
+//     is the first of the next round
+//
+// Actions are one 'uint16_t' per environment holding the held bits of every
+// 'ssn::action' (i.e. 'ssn::actions_t::down'); presses are derived from the
+// previous step's held bits.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ssn_env ssn_env_t;
+
+ssn_env_t* ssn_env_create( uint32_t count, uint32_t stage, uint32_t format,
+    double dt, uint64_t seed, uint32_t threads,
+    float* observations, float* rewards, uint8_t* dones );
+void ssn_env_destroy( ssn_env_t* env );
+
+uint32_t ssn_env_count( const ssn_env_t* env );
+uint32_t ssn_env_observation_size( const ssn_env_t* env );
+
+void ssn_env_reset( ssn_env_t* env );
+void ssn_env_step( ssn_env_t* env, const uint16_t* actions );
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
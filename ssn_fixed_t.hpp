@@ -0,0 +1,94 @@
+#ifndef SSN_FIXED_T_HPP
+#define SSN_FIXED_T_HPP
+
+#include "consts.h"
+
+namespace ssn {
+
+/// Class Declarations ///
+
+// NOTE(JRC): A signed Q15.16 fixed-point number. All operations are done in
+// integer arithmetic (with 64-bit intermediates), so the results are the same
+// bit-for-bit regardless of compiler, optimization level or FP settings.
+class fixed_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static int32_t FRAC_BITS = 16;
+    constexpr static int32_t ONE = 1 << FRAC_BITS;
+
+    /// Constructors ///
+
+    fixed_t() = default;
+    constexpr explicit fixed_t( const int32_t pValue ) : mValue( pValue * ONE ) {}
+    constexpr explicit fixed_t( const float64_t pValue ) :
+        mValue( static_cast<int32_t>(pValue * ONE + ((pValue >= 0.0) ? 0.5 : -0.5)) ) {}
+
+    constexpr static fixed_t raw( const int32_t pValue ) {
+        fixed_t result( 0 ); result.mValue = pValue; return result;
+    }
+
+    /// Conversions ///
+
+    constexpr explicit operator float32_t() const { return mValue / static_cast<float32_t>( ONE ); }
+    constexpr explicit operator float64_t() const { return mValue / static_cast<float64_t>( ONE ); }
+    constexpr explicit operator int32_t() const { return mValue >> FRAC_BITS; }
+
+    /// Operators ///
+
+    constexpr fixed_t operator-() const { return raw( -mValue ); }
+    constexpr fixed_t operator+( const fixed_t& pOther ) const { return raw( mValue + pOther.mValue ); }
+    constexpr fixed_t operator-( const fixed_t& pOther ) const { return raw( mValue - pOther.mValue ); }
+    constexpr fixed_t operator*( const fixed_t& pOther ) const {
+        return raw( static_cast<int32_t>((static_cast<int64_t>(mValue) * pOther.mValue) >> FRAC_BITS) );
+    }
+    constexpr fixed_t operator/( const fixed_t& pOther ) const {
+        return raw( static_cast<int32_t>((static_cast<int64_t>(mValue) * ONE) / pOther.mValue) );
+    }
+
+    fixed_t& operator+=( const fixed_t& pOther ) { return *this = *this + pOther; }
+    fixed_t& operator-=( const fixed_t& pOther ) { return *this = *this - pOther; }
+    fixed_t& operator*=( const fixed_t& pOther ) { return *this = *this * pOther; }
+    fixed_t& operator/=( const fixed_t& pOther ) { return *this = *this / pOther; }
+
+    constexpr bool operator==( const fixed_t& pOther ) const { return mValue == pOther.mValue; }
+    constexpr bool operator!=( const fixed_t& pOther ) const { return mValue != pOther.mValue; }
+    constexpr bool operator<( const fixed_t& pOther ) const { return mValue < pOther.mValue; }
+    constexpr bool operator>( const fixed_t& pOther ) const { return mValue > pOther.mValue; }
+    constexpr bool operator<=( const fixed_t& pOther ) const { return mValue <= pOther.mValue; }
+    constexpr bool operator>=( const fixed_t& pOther ) const { return mValue >= pOther.mValue; }
+
+    /// Functions ///
+
+    // NOTE(JRC): Digit-by-digit integer square root on the 32.32 widened value,
+    // which yields the correctly truncated 16.16 result without any FP math.
+    static fixed_t sqrt( const fixed_t& pValue ) {
+        uint64_t value = static_cast<uint64_t>( pValue.mValue > 0 ? pValue.mValue : 0 ) << FRAC_BITS;
+        uint64_t result = 0, bit = 1ull << 62;
+        while( bit > value ) { bit >>= 2; }
+        for( ; bit != 0; bit >>= 2 ) {
+            if( value >= result + bit ) {
+                value -= result + bit;
+                result = ( result >> 1 ) + bit;
+            } else {
+                result >>= 1;
+            }
+        }
+        return raw( static_cast<int32_t>(result) );
+    }
+
+    static fixed_t floor( const fixed_t& pValue ) {
+        return raw( pValue.mValue & ~(ONE - 1) );
+    }
+
+    /// Class Fields ///
+
+    public:
+
+    int32_t mValue;
+};
+
+}
+
+#endif
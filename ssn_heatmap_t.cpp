@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "ssn_heatmap_t.h"
+
+namespace ssn {
+
+/// Class Functions ///
+
+heatmap_t::heatmap_t() {
+    clear();
+}
+
+
+void heatmap_t::clear() {
+    std::memset( &mBins[0][0], 0, sizeof(mBins) );
+    mSampleCount = 0;
+}
+
+
+void heatmap_t::merge( const heatmap_t& pOther ) {
+    for( uint32_t layerIdx = 0; layerIdx < ssn::heat::_length; layerIdx++ ) {
+        for( uint32_t binIdx = 0; binIdx < heatmap_t::BIN_COUNT; binIdx++ ) {
+            mBins[layerIdx][binIdx] += pOther.mBins[layerIdx][binIdx];
+        }
+    }
+    mSampleCount += pOther.mSampleCount;
+}
+
+
+void heatmap_t::sample( const ssn::state_t* pState ) {
+    uint64_t* const puckBins = &mBins[ssn::heat::puck][0];
+    for( uint32_t puckIdx = 0; puckIdx < pState->puckCount; puckIdx++ ) {
+        puckBins[heatmap_t::bin( ssn::real::tof(pState->pucks[puckIdx].pos()) )]++;
+    }
+
+    uint64_t* const paddleBins = &mBins[ssn::heat::paddle][0];
+    for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+        paddleBins[heatmap_t::bin( ssn::real::tof(pState->paddles[paddleIdx].pos()) )]++;
+    }
+
+    mSampleCount++;
+}
+
+
+void heatmap_t::hit( const vec2r_t& pPos ) {
+    mBins[ssn::heat::hit][heatmap_t::bin( ssn::real::tof(pPos) )]++;
+}
+
+
+bool32_t heatmap_t::save( const char8_t* pPath ) const {
+    std::FILE* file = std::fopen( pPath, "wb" );
+    LLCE_CHECK_WARNING( file != nullptr,
+        "Couldn't save heatmap; failed to open file '" << pPath << "' for writing." );
+    if( file == nullptr ) {
+        return false;
+    }
+
+    const header_t cHeader = { heatmap_t::MAGIC, heatmap_t::VERSION,
+        heatmap_t::RESOLUTION, ssn::heat::_length, mSampleCount };
+    bool32_t saved =
+        std::fwrite( &cHeader, sizeof(cHeader), 1, file ) == 1 &&
+        std::fwrite( &mBins[0][0], sizeof(mBins), 1, file ) == 1;
+    saved = ( std::fclose(file) == 0 ) && saved;
+    return saved;
+}
+
+
+uint32_t heatmap_t::bin( const vec2f32_t& pPos ) {
+    // NOTE(JRC): Positions are truncated to bin coordinates and clamped with
+    // min/max rather than tested against the bounds so that binning compiles
+    // to straight-line code; wrapped entities can briefly sit just outside of
+    // the unit square, and these are folded into the edge bins.
+    const int32_t cMaxCoord = static_cast<int32_t>( heatmap_t::RESOLUTION ) - 1;
+    const int32_t cBinX = std::min( std::max(
+        static_cast<int32_t>(pPos.x * heatmap_t::RESOLUTION), 0), cMaxCoord );
+    const int32_t cBinY = std::min( std::max(
+        static_cast<int32_t>(pPos.y * heatmap_t::RESOLUTION), 0), cMaxCoord );
+    return static_cast<uint32_t>( cBinY * heatmap_t::RESOLUTION + cBinX );
+}
+
+}
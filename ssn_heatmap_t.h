@@ -0,0 +1,65 @@
+#ifndef SSN_HEATMAP_T_H
+#define SSN_HEATMAP_T_H
+
+#include "ssn.h"
+#include "ssn_real.hpp"
+#include "consts.h"
+
+namespace ssn {
+
+LLCE_ENUM( heat, puck, paddle, hit );
+
+// NOTE(JRC): A set of fixed-resolution position histograms (one per 'heat_e'
+// layer) over the unit square, which contains the bounds of every stage.
+// Counts are plain integers, so heatmaps from independent matches can be
+// merged by summation in any order.
+class heatmap_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t MAGIC = 0x484e5353; // units: 'SSNH' (little endian)
+    constexpr static uint32_t VERSION = 1;
+
+    constexpr static uint32_t RESOLUTION = 32; // units: bins per axis
+    constexpr static uint32_t BIN_COUNT = RESOLUTION * RESOLUTION;
+
+    /// Class Types ///
+
+    struct header_t {
+        uint32_t mMagic;
+        uint32_t mVersion;
+        uint32_t mResolution;
+        uint32_t mLayerCount;
+        uint64_t mSampleCount;
+    };
+
+    /// Constructors ///
+
+    heatmap_t();
+
+    /// Class Functions ///
+
+    void clear();
+    void merge( const heatmap_t& pOther );
+
+    void sample( const ssn::state_t* pState );
+    void hit( const vec2r_t& pPos );
+
+    bool32_t save( const char8_t* pPath ) const;
+
+    // NOTE(JRC): Bins are stored row-major from the bottom-left corner, so the
+    // bin containing world position (x, y) is at 'y * RESOLUTION + x'.
+    static uint32_t bin( const vec2f32_t& pPos );
+
+    /// Class Fields ///
+
+    public:
+
+    uint64_t mBins[ssn::heat::_length][BIN_COUNT]; // units: samples per bin
+    uint64_t mSampleCount;                         // units: ticks sampled
+};
+
+}
+
+#endif
@@ -0,0 +1,103 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "ssn_latency.h"
+
+namespace ssn {
+
+namespace latency {
+
+/// Global Variables ///
+
+typedef std::chrono::steady_clock latency_clock_t;
+
+static histogram_t sHistograms[MAX_MODE_COUNT];
+static latency_clock_t::time_point sPendingTime;
+static bool32_t sIsPending = false, sIsApplied = false;
+static uint16_t sPrevDown = 0;
+
+/// Functions ///
+
+void input( const ssn::actions_t& pActions ) {
+    // NOTE(JRC): Edges that arrive while an earlier edge is still in flight
+    // are folded into it, so each measurement is from the oldest unshown edge.
+    const bool32_t cHasEdge = pActions.pressed != 0 || pActions.down != sPrevDown;
+    sPrevDown = pActions.down;
+    if( cHasEdge && !sIsPending ) {
+        sPendingTime = latency_clock_t::now();
+        sIsPending = true;
+        sIsApplied = false;
+    }
+}
+
+
+void apply() {
+    sIsApplied = sIsPending;
+}
+
+
+void present( const ssn::mode_e pMode ) {
+    if( !sIsApplied || pMode < 0 || static_cast<uint32_t>(pMode) >= MAX_MODE_COUNT ) {
+        return;
+    }
+
+    const uint64_t cLatency = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>(
+        latency_clock_t::now() - sPendingTime).count() );
+    uint32_t bucketIdx = 0;
+    for( uint64_t bucketMin = 2; bucketMin <= cLatency && bucketIdx + 1 < BUCKET_COUNT; bucketMin <<= 1 ) {
+        bucketIdx++;
+    }
+
+    histogram_t& histogram = sHistograms[pMode];
+    histogram.mBuckets[bucketIdx]++;
+    histogram.mCount++;
+    histogram.mTotal += cLatency;
+    histogram.mMax = ( cLatency > histogram.mMax ) ? cLatency : histogram.mMax;
+
+    sIsPending = sIsApplied = false;
+}
+
+
+const histogram_t* histogram( const ssn::mode_e pMode ) {
+    return ( pMode >= 0 && static_cast<uint32_t>(pMode) < MAX_MODE_COUNT ) ? &sHistograms[pMode] : nullptr;
+}
+
+
+void clear() {
+    std::memset( &sHistograms[0], 0, sizeof(sHistograms) );
+    sIsPending = sIsApplied = false;
+}
+
+
+bool32_t dump( const char8_t* pPath ) {
+    std::FILE* file = std::fopen( pPath, "w" );
+    LLCE_CHECK_WARNING( file != nullptr,
+        "Couldn't dump latency histograms; failed to open file '" << pPath << "' for writing." );
+    if( file == nullptr ) {
+        return false;
+    }
+
+    // NOTE(JRC): Each mode with measurements is written as a JSON line with
+    // bucket 'i' counting latencies in [2**i, 2**(i+1)) microseconds.
+    for( uint32_t modeIdx = 0; modeIdx < MAX_MODE_COUNT; modeIdx++ ) {
+        const histogram_t& histogram = sHistograms[modeIdx];
+        if( histogram.mCount == 0 ) { continue; }
+
+        std::fprintf( file, "{\"mode\": %u, \"count\": %llu, \"mean_us\": %.1f, \"max_us\": %llu, \"buckets\": [",
+            modeIdx, static_cast<unsigned long long>(histogram.mCount),
+            static_cast<float64_t>(histogram.mTotal) / histogram.mCount,
+            static_cast<unsigned long long>(histogram.mMax) );
+        for( uint32_t bucketIdx = 0; bucketIdx < BUCKET_COUNT; bucketIdx++ ) {
+            std::fprintf( file, "%s%llu", (bucketIdx == 0) ? "" : ", ",
+                static_cast<unsigned long long>(histogram.mBuckets[bucketIdx]) );
+        }
+        std::fprintf( file, "]}\n" );
+    }
+
+    return std::fclose( file ) == 0;
+}
+
+}
+
+}
@@ -0,0 +1,47 @@
+#ifndef SSN_LATENCY_H
+#define SSN_LATENCY_H
+
+#include "ssn.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+namespace latency {
+
+/// Constants ///
+
+constexpr static uint32_t MAX_MODE_COUNT = 8;
+constexpr static uint32_t BUCKET_COUNT = 24; // units: bucket 'i' holds [2**i, 2**(i+1)) microseconds (bucket 0 from 0)
+
+/// Types ///
+
+struct histogram_t {
+    uint64_t mBuckets[BUCKET_COUNT];
+    uint64_t mCount;
+    uint64_t mTotal; // units: microseconds
+    uint64_t mMax;   // units: microseconds
+};
+
+/// Functions ///
+
+// NOTE(JRC): Latencies are measured in three stages: 'input' timestamps the
+// first action edge (press or release) seen since the last measurement,
+// 'apply' marks that the pending edge has been handed to the simulation (e.g.
+// 'paddle_t::move'/'rush'), and 'present' records the time from the edge to
+// the end of the first 'render' after it was applied. Only the simulation
+// thread of the harness may call these functions.
+
+void input( const ssn::actions_t& pActions );
+void apply();
+void present( const ssn::mode_e pMode );
+
+const histogram_t* histogram( const ssn::mode_e pMode );
+void clear();
+bool32_t dump( const char8_t* pPath );
+
+}
+
+}
+
+#endif
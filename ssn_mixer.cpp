@@ -0,0 +1,253 @@
+#include <SDL2/SDL.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#include <glm/common.hpp>
+#include <glm/ext/scalar_constants.hpp>
+
+#include "ssn_spsc_ring_t.hpp"
+#include "ssn_mixer.h"
+
+namespace ssn {
+
+namespace mixer {
+
+/// Constants ///
+
+constexpr static uint32_t RING_CAPACITY = 1 << 6; // units: commands
+constexpr static uint32_t CHANNEL_COUNT = 2;
+constexpr static uint32_t MAX_SOUND_SAMPLES = SAMPLE_RATE / 2; // units: samples (0.5 seconds)
+constexpr static int32_t GAIN_ONE = 1 << 15; // units: unity gain (Q15 fixed-point)
+constexpr static float32_t SOUND_AMPLITUDE = 0.4f; // units: peak / full scale
+
+constexpr static float32_t SOUND_DURATIONS[] = { 0.06f, 0.30f, 0.12f, 0.50f }; // units: seconds
+
+static_assert( LLCE_ELEM_COUNT(SOUND_DURATIONS) == sound::_length,
+    "Incorrect number of sound durations; "
+    "please add a duration for all sounds in enumeration "
+    "'ssn::mixer::sound::sound_e' to the array 'SOUND_DURATIONS' in 'ssn_mixer.cpp'." );
+
+/// Types ///
+
+struct command_t {
+    uint8_t mSound;                 // units: 'sound_e'
+    uint8_t mReserved;
+    uint16_t mGains[CHANNEL_COUNT]; // units: Q15 gain per channel
+};
+
+struct voice_t {
+    uint32_t mSound;               // units: 'sound_e'
+    uint32_t mCursor;              // units: samples into the sound's buffer
+    int32_t mGains[CHANNEL_COUNT]; // units: Q15 gain per channel
+    bool32_t mActive;
+};
+
+/// Global Variables ///
+
+static ssn::spsc_ring_t<command_t, RING_CAPACITY> sRing;
+static std::atomic<bool32_t> sActive( false );
+static SDL_AudioDeviceID sDevice = 0;
+
+static int16_t sSounds[sound::_length][MAX_SOUND_SAMPLES];
+static uint32_t sSoundLengths[sound::_length];
+
+// NOTE(JRC): These variables are only accessed by the audio callback thread
+// while the device is open.
+static voice_t sVoices[MAX_VOICE_COUNT];
+static uint32_t sNextVoice = 0;
+static int32_t sMix[DEVICE_SAMPLES * CHANNEL_COUNT];
+
+/// Helper Functions ///
+
+static void synthesize() {
+    const float32_t cTwoPi = 2.0f * glm::pi<float32_t>();
+    const float32_t cSampleDT = 1.0f / SAMPLE_RATE;
+
+    for( uint32_t soundIdx = 0; soundIdx < sound::_length; soundIdx++ ) {
+        const float32_t cDuration = SOUND_DURATIONS[soundIdx];
+        const uint32_t cLength = glm::min(
+            static_cast<uint32_t>(cDuration * SAMPLE_RATE), MAX_SOUND_SAMPLES );
+
+        float32_t phase = 0.0f, noise = 0.0f;
+        uint32_t noiseState = 0x9e3779b9u;
+        for( uint32_t sampleIdx = 0; sampleIdx < cLength; sampleIdx++ ) {
+            const float32_t cTime = sampleIdx * cSampleDT;
+            const float32_t cProgress = cTime / cDuration;
+
+            float32_t sample = 0.0f;
+            if( soundIdx == sound::hit ) {
+                // A short, sharply decaying blip.
+                phase += cTwoPi * 880.0f * cSampleDT;
+                sample = std::sin( phase ) * std::exp( -cTime / 0.015f );
+            } else if( soundIdx == sound::claim ) {
+                // A rising three-note arpeggio (C5, E5, G5).
+                const static float32_t csNotes[] = { 523.25f, 659.25f, 783.99f };
+                const uint32_t cNoteIdx = glm::min( static_cast<uint32_t>(3.0f * cProgress), 2u );
+                const float32_t cNoteTime = cTime - cNoteIdx * ( cDuration / 3.0f );
+                phase += cTwoPi * csNotes[cNoteIdx] * cSampleDT;
+                sample = std::sin( phase ) * std::exp( -cNoteTime / 0.05f );
+            } else if( soundIdx == sound::rush ) {
+                // A burst of low-passed noise that fades out.
+                noiseState ^= noiseState << 13; noiseState ^= noiseState >> 17; noiseState ^= noiseState << 5;
+                noise += 0.3f * ( (noiseState / 4294967295.0f) * 2.0f - 1.0f - noise );
+                sample = 2.0f * noise * ( 1.0f - cProgress );
+            } else if( soundIdx == sound::end ) {
+                // A falling sweep from E5 down to A3.
+                phase += cTwoPi * 660.0f * std::pow( 1.0f / 3.0f, cProgress ) * cSampleDT;
+                sample = std::sin( phase ) * ( 1.0f - cProgress );
+            }
+
+            sSounds[soundIdx][sampleIdx] = static_cast<int16_t>(
+                32767.0f * SOUND_AMPLITUDE * glm::clamp(sample, -1.0f, 1.0f) );
+        }
+        sSoundLengths[soundIdx] = cLength;
+    }
+}
+
+
+static void mix( void* pUserData, Uint8* pStream, int pBytes ) {
+    int16_t* output = reinterpret_cast<int16_t*>( pStream );
+    const uint32_t cFrameCount = static_cast<uint32_t>( pBytes ) / ( CHANNEL_COUNT * sizeof(int16_t) );
+
+    { // Start Requested Voices //
+        // NOTE(JRC): When all voices are busy, the voice started longest ago
+        // is replaced since it's the closest to finishing anyway.
+        command_t commands[RING_CAPACITY];
+        const uint32_t cCommandCount = sRing.pop( &commands[0], RING_CAPACITY );
+        for( uint32_t commandIdx = 0; commandIdx < cCommandCount; commandIdx++ ) {
+            const command_t& cCommand = commands[commandIdx];
+            voice_t& voice = sVoices[sNextVoice];
+            voice.mSound = cCommand.mSound;
+            voice.mCursor = 0;
+            voice.mGains[0] = cCommand.mGains[0];
+            voice.mGains[1] = cCommand.mGains[1];
+            voice.mActive = true;
+            sNextVoice = ( sNextVoice + 1 ) % MAX_VOICE_COUNT;
+        }
+    }
+
+    // NOTE(JRC): The device is opened with a fixed buffer size, but the output
+    // is mixed in chunks regardless in case the driver requests more frames.
+    for( uint32_t frameIdx = 0; frameIdx < cFrameCount; frameIdx += DEVICE_SAMPLES ) {
+        const uint32_t cChunkCount = glm::min( DEVICE_SAMPLES, cFrameCount - frameIdx );
+        std::memset( &sMix[0], 0, sizeof(sMix) );
+
+        for( uint32_t voiceIdx = 0; voiceIdx < MAX_VOICE_COUNT; voiceIdx++ ) {
+            voice_t& voice = sVoices[voiceIdx];
+            if( !voice.mActive ) { continue; }
+
+            const int16_t* cSound = &sSounds[voice.mSound][voice.mCursor];
+            const uint32_t cSampleCount = glm::min( cChunkCount,
+                sSoundLengths[voice.mSound] - voice.mCursor );
+            for( uint32_t sampleIdx = 0; sampleIdx < cSampleCount; sampleIdx++ ) {
+                sMix[CHANNEL_COUNT * sampleIdx + 0] += ( cSound[sampleIdx] * voice.mGains[0] ) >> 15;
+                sMix[CHANNEL_COUNT * sampleIdx + 1] += ( cSound[sampleIdx] * voice.mGains[1] ) >> 15;
+            }
+
+            voice.mCursor += cSampleCount;
+            voice.mActive = voice.mCursor < sSoundLengths[voice.mSound];
+        }
+
+        int16_t* chunkOutput = &output[CHANNEL_COUNT * frameIdx];
+        for( uint32_t mixIdx = 0; mixIdx < CHANNEL_COUNT * cChunkCount; mixIdx++ ) {
+            chunkOutput[mixIdx] = static_cast<int16_t>( glm::clamp(sMix[mixIdx], -32768, 32767) );
+        }
+    }
+}
+
+/// Functions ///
+
+bool32_t start() {
+    if( sActive.load() ) {
+        return true;
+    }
+
+    const bool32_t cInitialized = SDL_InitSubSystem( SDL_INIT_AUDIO ) == 0;
+    LLCE_CHECK_WARNING( cInitialized,
+        "Couldn't start mixer; failed to initialize audio (" << SDL_GetError() << ")." );
+    if( !cInitialized ) {
+        return false;
+    }
+
+    synthesize();
+    std::memset( &sVoices[0], 0, sizeof(sVoices) );
+    sNextVoice = 0;
+
+    // NOTE(JRC): Requests made before the last 'stop' may still be queued; the
+    // callback isn't running yet, so it's safe to drain them from this thread.
+    command_t staleCommands[RING_CAPACITY];
+    sRing.pop( &staleCommands[0], RING_CAPACITY );
+
+    SDL_AudioSpec desiredSpec, obtainedSpec;
+    SDL_zero( desiredSpec );
+    desiredSpec.freq = SAMPLE_RATE;
+    desiredSpec.format = AUDIO_S16SYS;
+    desiredSpec.channels = CHANNEL_COUNT;
+    desiredSpec.samples = DEVICE_SAMPLES;
+    desiredSpec.callback = mix;
+
+    sDevice = SDL_OpenAudioDevice( nullptr, 0, &desiredSpec, &obtainedSpec, 0 );
+    LLCE_CHECK_WARNING( sDevice != 0,
+        "Couldn't start mixer; failed to open audio device (" << SDL_GetError() << ")." );
+    if( sDevice == 0 ) {
+        SDL_QuitSubSystem( SDL_INIT_AUDIO );
+        return false;
+    }
+
+    sActive.store( true, std::memory_order_release );
+    SDL_PauseAudioDevice( sDevice, 0 );
+    return true;
+}
+
+
+void stop() {
+    if( !sActive.load() ) {
+        return;
+    }
+
+    // NOTE(JRC): Closing the device waits for any running callback to finish.
+    sActive.store( false, std::memory_order_release );
+    SDL_CloseAudioDevice( sDevice );
+    sDevice = 0;
+    SDL_QuitSubSystem( SDL_INIT_AUDIO );
+}
+
+
+bool32_t active() {
+    return sActive.load( std::memory_order_relaxed );
+}
+
+
+void play( const sound_e pSound, const float32_t pPan, const float32_t pGain ) {
+    if( !sActive.load(std::memory_order_relaxed) ) {
+        return;
+    }
+
+    // NOTE(JRC): Constant-power panning keeps the loudness of a sound steady
+    // as it moves across the stage.
+    const float32_t cPanAngle = 0.5f * glm::pi<float32_t>() * glm::clamp( pPan, 0.0f, 1.0f );
+    const float32_t cGain = GAIN_ONE * glm::clamp( pGain, 0.0f, 1.0f );
+
+    command_t command;
+    command.mSound = static_cast<uint8_t>( pSound );
+    command.mReserved = 0;
+    command.mGains[0] = static_cast<uint16_t>( cGain * std::cos(cPanAngle) );
+    command.mGains[1] = static_cast<uint16_t>( cGain * std::sin(cPanAngle) );
+
+    // NOTE(JRC): Requests are dropped when the queue is full, which can only
+    // happen if the audio thread has stalled.
+    sRing.push( command );
+}
+
+/// Global Guards ///
+
+// NOTE(JRC): The audio callback lives in this module, so the device must be
+// closed before the module is unloaded (e.g. on hot reloads); static objects
+// are destroyed on unload, so this guard does so.
+static struct guard_t { ~guard_t() { stop(); } } sGuard;
+
+}
+
+}
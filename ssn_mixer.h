@@ -0,0 +1,39 @@
+#ifndef SSN_MIXER_H
+#define SSN_MIXER_H
+
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+namespace mixer {
+
+/// Constants ///
+
+LLCE_ENUM( sound, hit, claim, rush, end );
+
+constexpr static uint32_t SAMPLE_RATE = 48000; // units: samples / second
+constexpr static uint32_t DEVICE_SAMPLES = 256; // units: samples per callback (~5ms)
+constexpr static uint32_t MAX_VOICE_COUNT = 16;
+
+/// Functions ///
+
+// NOTE(JRC): Sounds are mixed on SDL's audio callback thread from PCM buffers
+// that are synthesized by 'start', so the callback never allocates, locks or
+// blocks. Sounds may only be requested from a single thread (the thread that
+// runs the simulation); each request only copies a command into a fixed-size
+// ring buffer, and requests made while the mixer is stopped are ignored. The
+// mixer works with any SDL audio driver, including 'SDL_AUDIODRIVER=dummy'.
+
+bool32_t start();
+void stop();
+bool32_t active();
+
+// Plays the given sound panned by 'pPan' (0: left, 1: right) at 'pGain' volume.
+void play( const sound_e pSound, const float32_t pPan = 0.5f, const float32_t pGain = 1.0f );
+
+}
+
+}
+
+#endif
@@ -1,5 +1,7 @@
 #include <cstring>
+#include <new>
 #include <sstream>
+#include <type_traits>
 
 #include <SDL2/SDL_opengl.h>
 #include <SDL2/SDL_opengl_glext.h>
@@ -16,8 +18,15 @@
 #include "util.hpp"
 
 #include "ssn_modes.h"
+#include "ssn_scratch.h"
 #include "ssn_data.h"
 #include "ssn_entities.h"
+#include "ssn_wrap.h"
+#include "ssn_telemetry.h"
+#include "ssn_latency.h"
+#include "ssn_mixer.h"
+#include "ssn_bot_t.h"
+#include "ssn_recorder.h"
 
 namespace ssn {
 
@@ -29,6 +38,8 @@ namespace mode {
 
 typedef bool32_t (*update_f)( ssn::state_t*, ssn::input_t*, const float64_t, const float64_t );
 typedef bool32_t (*render_f)( const ssn::state_t*, const ssn::input_t*, const ssn::output_t* );
+typedef bool32_t (*step_f)( ssn::state_t*, const ssn::actions_t&, const float64_t,
+    ssn::heatmap_t*, ssn::mode::game::events_t* );
 
 // Input Data //
 
@@ -43,6 +54,7 @@ constexpr static uint32_t MENU_ACTIONS[] = { ssn::action::unbound, ssn::action::
 // Per-Mode Data //
 
 constexpr static float64_t SCORE_PHASE_DURATIONS[] = { 1.0, 2.0, 1.0 };
+constexpr static uint8_t SCORE_OWNERSHIP_ALPHA = 0x80;
 
 constexpr static char8_t TITLE_ITEM_TEXT[][8] = { "START", "INPUT", "EXIT " };
 constexpr static char8_t RESET_ITEM_TEXT[][8] = { "REPLAY", "EXIT  " };
@@ -60,25 +72,58 @@ static_assert( LLCE_ELEM_COUNT(STAGE_NAMES) == ssn::stage_e::_length,
     "Incorrect number of stage names; "
     "please add the names of all stages in enumeration "
     "'ssn::stage::stage_e' to the array 'STAGE_NAMES' in 'ssn_consts.h'." );
-static_assert( SELECT_ITEM_COUNT >= ssn::stage_e::_length,
+static_assert( SELECT_ITEM_COUNT >= ssn::stage_e::_length * ssn::format_e::_length,
     "Insufficient number of selection items; "
-    "please add enough selection items to cover all stages in enumeration "
-    "'ssn::stage::stage_e' to the array 'SELCT_ITEM_DIMS' in 'ssn_modes.cpp'." );
+    "please add enough selection items to cover all stages/formats in enumerations "
+    "'ssn::stage::stage_e'/'ssn::format::format_e' to the array 'SELCT_ITEM_DIMS' in 'ssn_modes.cpp'." );
+static_assert( LLCE_ELEM_COUNT(FORMAT_PADDLE_GRIDS) == ssn::format_e::_length &&
+        LLCE_ELEM_COUNT(FORMAT_PUCK_GRIDS) == ssn::format_e::_length &&
+        LLCE_ELEM_COUNT(FORMAT_TAGS) == ssn::format_e::_length,
+    "Incorrect number of format specifications; "
+    "please add the paddle/puck grids and tags of all formats in enumeration "
+    "'ssn::format::format_e' to the arrays 'FORMAT_*' in 'ssn_consts.h'." );
+static_assert( 2 * FORMAT_PADDLE_GRIDS[ssn::format::melee].x * FORMAT_PADDLE_GRIDS[ssn::format::melee].y <= ssn::MAX_PADDLE_COUNT &&
+        FORMAT_PUCK_GRIDS[ssn::format::melee].x * FORMAT_PUCK_GRIDS[ssn::format::melee].y <= ssn::MAX_PUCK_COUNT &&
+        ssn::MAX_PADDLE_COUNT + ssn::MAX_PUCK_COUNT <= ssn::entity_store_t::MAX_ENTITY_COUNT,
+    "Insufficient entity capacity; "
+    "please raise 'ssn::MAX_{PADDLE|PUCK}_COUNT' in 'ssn_consts.h' and "
+    "'ssn::entity_store_t::MAX_ENTITY_COUNT' to cover the largest format." );
+static_assert( ssn::action::_length <= 8 * sizeof(uint16_t),
+    "Insufficient number of action bits; "
+    "please widen the bit fields of 'ssn::actions_t' in 'ssn.h' to cover all "
+    "actions in enumeration 'ssn::action::action_e'." );
+static_assert( std::is_trivially_copyable<ssn::state_t>::value,
+    "Incorrect state layout; "
+    "please replace any owning or absolute pointers in 'ssn::state_t' with "
+    "indices or 'ssn::rel_ptr_t' so that states can be copied as raw memory." );
 
 /// Helper Functions ///
 
+ssn::actions_t capture( ssn::input_t* pInput ) {
+    ssn::actions_t actions = { 0, 0 };
+    for( uint32_t action = 0; action < ssn::action::_length; action++ ) {
+        actions.down |= static_cast<uint16_t>( pInput->isDownAct(action) ? 1 << action : 0 );
+        actions.pressed |= static_cast<uint16_t>( pInput->isPressedAct(action) ? 1 << action : 0 );
+    }
+    return actions;
+}
+
+
 void gameboard_render( const ssn::state_t* pState, const ssn::input_t* pInput, const ssn::output_t* pOutput ) {
     const ssn::bounds_t* const bounds = &pState->bounds;
-    const ssn::puck_t* const puck = &pState->puck;
+    const ssn::puck_t* const pucks = &pState->pucks[0];
     const ssn::paddle_t* const paddles = &pState->paddles[0];
     const ssn::particulator_t* const particulator = &pState->particulator;
 
     { // Game State Render //
         bounds->render();
-        puck->render();
+        for( uint32_t puckIdx = 0; puckIdx < pState->puckCount; puckIdx++ ) {
+            pucks[puckIdx].render();
+        }
         particulator->render();
-        paddles[ssn::team::left].render();
-        paddles[ssn::team::right].render();
+        for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+            paddles[paddleIdx].render();
+        }
 
         { // Out-of-Bounds Occlusion //
             const float32_t cBoundsBorderSizes[] = {
@@ -128,6 +173,95 @@ void gameboard_render( const ssn::state_t* pState, const ssn::input_t* pInput, c
     }
 }
 
+
+void ownership_render( const ssn::state_t* pState, const ssn::scratch::score_t* pScratch ) {
+    // NOTE(JRC): The ownership map is mirrored into a texture as the tally fronts
+    // sweep over it; only the newly tallied columns are expanded and uploaded each
+    // frame, and only tallied columns are ever drawn, so the texture never needs
+    // to be cleared between score screens (which are told apart by scratch epoch).
+    static color4u8_t sPixels[SCORE_SAMPLES_COUNT];
+    static GLuint sTexture = 0;
+    static uint64_t sEpoch = 0;
+    static uint32_t sUploadedColumns[2] = { 0, 0 };
+
+    if( sTexture == 0 ) {
+        glGenTextures( 1, &sTexture );
+        glBindTexture( GL_TEXTURE_2D, sTexture );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, SCORE_SAMPLE_RES.x, SCORE_SAMPLE_RES.y,
+            0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr );
+    }
+    if( sEpoch != pState->scratch.mEpoch ) {
+        sEpoch = pState->scratch.mEpoch;
+        sUploadedColumns[0] = sUploadedColumns[1] = 0;
+    }
+
+    glPushAttrib( GL_CURRENT_BIT | GL_ENABLE_BIT | GL_TEXTURE_BIT );
+    glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
+    glEnable( GL_TEXTURE_2D );
+    glEnable( GL_BLEND );
+    glBindTexture( GL_TEXTURE_2D, sTexture );
+
+    { // Upload Tallied Columns //
+        glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+        glPixelStorei( GL_UNPACK_ROW_LENGTH, SCORE_SAMPLE_RES.x );
+
+        for( uint32_t tallyIdx = 0; tallyIdx < 2; tallyIdx++ ) {
+            const uint32_t cPrevColumns = sUploadedColumns[tallyIdx];
+            const uint32_t cCurrColumns = pScratch->tallyColumns[tallyIdx];
+            if( cCurrColumns <= cPrevColumns ) { continue; }
+
+            const uint32_t cColumnMin = tallyIdx ? SCORE_SAMPLE_RES.x - cCurrColumns : cPrevColumns;
+            const uint32_t cColumnMax = tallyIdx ? SCORE_SAMPLE_RES.x - cPrevColumns : cCurrColumns;
+            for( uint32_t yIdx = 0; yIdx < SCORE_SAMPLE_RES.y; yIdx++ ) {
+                for( uint32_t xIdx = cColumnMin; xIdx < cColumnMax; xIdx++ ) {
+                    uint32_t sIdx = yIdx * SCORE_SAMPLE_RES.x + xIdx;
+                    uint32_t sampleIdx = sIdx / SCORE_SAMPLES_PER_BYTE;
+                    uint32_t sampleOffset = SCORE_SAMPLE_BITS * ( sIdx % SCORE_SAMPLES_PER_BYTE );
+
+                    uint8_t sampleData = ( pScratch->samples[sampleIdx] >> sampleOffset ) & 0b11;
+                    sPixels[sIdx] = color4u8_t( 0x00, 0x00, 0x00, 0x00 );
+                    for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
+                        if( sampleData & (1 << team) ) {
+                            sPixels[sIdx] = ssn::color::TEAM[team];
+                            sPixels[sIdx].a = SCORE_OWNERSHIP_ALPHA;
+                        }
+                    }
+                }
+            }
+
+            glPixelStorei( GL_UNPACK_SKIP_PIXELS, cColumnMin );
+            glTexSubImage2D( GL_TEXTURE_2D, 0, cColumnMin, 0,
+                cColumnMax - cColumnMin, SCORE_SAMPLE_RES.y,
+                GL_RGBA, GL_UNSIGNED_BYTE, &sPixels[0] );
+            sUploadedColumns[tallyIdx] = cCurrColumns;
+        }
+    }
+
+    { // Render Tallied Columns //
+        glColor4ub( 0xff, 0xff, 0xff, 0xff );
+        glBegin( GL_QUADS ); {
+            for( uint32_t tallyIdx = 0; tallyIdx < 2; tallyIdx++ ) {
+                const float32_t cColumnsDX = sUploadedColumns[tallyIdx] /
+                    static_cast<float32_t>( SCORE_SAMPLE_RES.x );
+                const float32_t cColumnMin = tallyIdx ? 1.0f - cColumnsDX : 0.0f;
+                const float32_t cColumnMax = tallyIdx ? 1.0f : cColumnsDX;
+
+                glTexCoord2f( cColumnMin, 0.0f ); glVertex2f( cColumnMin, 0.0f );
+                glTexCoord2f( cColumnMax, 0.0f ); glVertex2f( cColumnMax, 0.0f );
+                glTexCoord2f( cColumnMax, 1.0f ); glVertex2f( cColumnMax, 1.0f );
+                glTexCoord2f( cColumnMin, 1.0f ); glVertex2f( cColumnMin, 1.0f );
+            }
+        } glEnd();
+    }
+
+    glPopClientAttrib();
+    glPopAttrib();
+}
+
 /// 'ssn::mode::game' Functions  ///
 
 bool32_t game::init( ssn::state_t* pState, ssn::input_t* pInput ) {
@@ -139,25 +273,77 @@ bool32_t game::init( ssn::state_t* pState, ssn::input_t* pInput ) {
     const float32_t cPaddleRadius = 4.0e-2f;
     const float32_t cPuckRadius = cPaddleRadius * 5.0e-1f;
 
-    pState->bounds = ssn::bounds_t( llce::box_t(cStageCenter, cStageDims,
+    // NOTE(JRC): The bounds are constructed in place (rather than assigned from
+    // a temporary) so that every byte of the state is a function of the inputs,
+    // which peers and replays rely on to compare states directly.
+    new( &pState->bounds ) ssn::bounds_t( llce::box_t(cStageCenter, cStageDims,
         llce::geom::anchor2D::mm) );
 
-    pState->puck = ssn::puck_t( llce::circle_t(cStageCenter, cPuckRadius),
-        ssn::team::neutral, &pState->bounds );
+    pState->entities.clear();
 
-    for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
-        float32_t paddleXFactor = (team == ssn::team::left) ? 0.25f : 0.75f;
-        vec2f32_t paddleCenter(
+    // NOTE(JRC): Each team's paddles fill a grid in the center of their
+    // half of the stage (i.e. a single paddle sits at 25%/75% width).
+    const vec2u32_t cPaddleGrid = ssn::FORMAT_PADDLE_GRIDS[pState->fid];
+    const vec2f32_t cPaddleGridDims( 0.5f * cStageDims.x * cPaddleGrid.x / (cPaddleGrid.x + 1.0f), cStageDims.y );
+    vec2f32_t paddleCenters[ssn::MAX_PADDLE_COUNT];
+
+    pState->paddleCount = 2 * cPaddleGrid.x * cPaddleGrid.y;
+    for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+        const uint8_t cTeam = paddleIdx % 2, cTeamIdx = paddleIdx / 2;
+        float32_t paddleXFactor = (cTeam == ssn::team::left) ? 0.25f : 0.75f;
+        vec2f32_t& paddleCenter = paddleCenters[paddleIdx];
+        paddleCenter = vec2f32_t(
             cStageCenter.x - (cStageDims.x * 0.5f) + cStageDims.x * paddleXFactor,
-            cStageCenter.x - (cStageDims.x * 0.5f) + cStageDims.x * 0.5f );
-        pState->paddles[team] = ssn::paddle_t( llce::circle_t(paddleCenter, cPaddleRadius),
-            static_cast<ssn::team_e>(team), &pState->bounds );
+            cStageCenter.y - (cStageDims.y * 0.5f) + cStageDims.y * 0.5f );
+        paddleCenter += cPaddleGridDims * vec2f32_t(
+            (cTeamIdx % cPaddleGrid.x + 0.5f) / cPaddleGrid.x - 0.5f,
+            (cTeamIdx / cPaddleGrid.x + 0.5f) / cPaddleGrid.y - 0.5f );
     }
 
-    pState->particulator = ssn::particulator_t( &pState->rng );
+    { // Initialize Pucks //
+        // NOTE(JRC): The puck grid is denser than the paddle grid in the busier
+        // formats, so some of its cells overlap paddles; these cells are left
+        // empty (making the grid's size an upper bound on the puck count) since
+        // their pucks would otherwise be hit on the first tick.
+        const vec2u32_t cPuckGrid = ssn::FORMAT_PUCK_GRIDS[pState->fid];
+        const vec2f32_t cPuckGridMin = cStageCenter - 0.5f * cStageDims;
+        const float32_t cSpawnDist = cPaddleRadius + 1.5f * cPuckRadius;
+
+        pState->puckCount = 0;
+        for( uint32_t cellIdx = 0; cellIdx < cPuckGrid.x * cPuckGrid.y; cellIdx++ ) {
+            vec2f32_t puckCenter = cPuckGridMin + cStageDims * vec2f32_t(
+                (cellIdx % cPuckGrid.x + 0.5f) / cPuckGrid.x,
+                (cellIdx / cPuckGrid.x + 0.5f) / cPuckGrid.y );
+
+            bool32_t isCellClear = true;
+            for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount && isCellClear; paddleIdx++ ) {
+                const vec2f32_t cPaddleDelta = ssn::real::tof( ssn::wrap::delta(
+                    ssn::real::tor(paddleCenters[paddleIdx]), ssn::real::tor(puckCenter),
+                    ssn::real::tor(cStageDims)) );
+                isCellClear = glm::length( cPaddleDelta ) >= cSpawnDist;
+            }
+            if( !isCellClear ) { continue; }
+
+            new( &pState->pucks[pState->puckCount++] ) ssn::puck_t( &pState->entities,
+                llce::circle_t(puckCenter, cPuckRadius), ssn::team::neutral, &pState->bounds );
+        }
+    }
+
+    { // Initialize Paddles //
+        for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+            const uint8_t cTeam = paddleIdx % 2;
+            new( &pState->paddles[paddleIdx] ) ssn::paddle_t( &pState->entities,
+                llce::circle_t(paddleCenters[paddleIdx], cPaddleRadius),
+                static_cast<ssn::team_e>(cTeam), &pState->bounds );
+        }
+    }
+
+    pState->broadphase.reset( pState->puckCount, pState->paddleCount );
+
+    pState->particulator = ssn::particulator_t();
 
     // { // Testing Score Calculations //
-    //     ssn::team_entity_t testEntity( llce::circle_t(0.0f, 0.0f, 0.0f), ssn::team::right );
+    //     ssn::team_entity_t testEntity( &pState->entities, llce::circle_t(0.0f, 0.0f, 0.0f), ssn::team::right );
     //     const llce::box_t& testBBox = pState->bounds.mBBox;
 
     //     // const vec2f32_t cTestAreas[2][3] = {
@@ -188,9 +374,7 @@ bool32_t game::init( ssn::state_t* pState, ssn::input_t* pInput ) {
     //     for( uint32_t areaIdx = 0; areaIdx < cTestAreaCount; areaIdx++ ) {
     //         testEntity.change( cTestTeams[areaIdx] );
     //         for( uint32_t cornerIdx = 0; cornerIdx < ssn::bounds_t::AREA_CORNER_COUNT; cornerIdx++ ) {
-    //             vec2f32_t prevCenter = testEntity.mBounds.mCenter;
-    //             testEntity.mBounds.mCenter = cTestAreas[areaIdx][cornerIdx];
-    //             testEntity.mBBox.mPos += ( testEntity.mBounds.mCenter - prevCenter );
+    //             testEntity.pos() = cTestAreas[areaIdx][cornerIdx];
     //             pState->bounds.claim( &testEntity );
     //         }
     //     }
@@ -200,35 +384,121 @@ bool32_t game::init( ssn::state_t* pState, ssn::input_t* pInput ) {
 }
 
 
+ssn::actions_t game::actions( const ssn::state_t* pState, ssn::input_t* pInput ) {
+    ssn::actions_t actions = ssn::mode::capture( pInput );
+
+    // NOTE(JRC): Bot budgets count work rather than time, so bots always act
+    // the same way in the same state; replays record these actions.
+    for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
+        if( pState->selectBotTeams & (1 << team) ) {
+            ssn::bot_t bot( static_cast<ssn::team_e>(team) );
+            const ssn::actions_t cBotActions = bot.act( pState );
+            actions.down |= cBotActions.down;
+            actions.pressed |= cBotActions.pressed;
+        }
+    }
+
+    return actions;
+}
+
+
 bool32_t game::update( ssn::state_t* pState, ssn::input_t* pInput, const float64_t pDT ) {
+    game::events_t events;
+    events.mCount = events.mDropped = 0;
+    events.mInputsApplied = events.mRoundEnded = false;
+    // NOTE(JRC): Actions are computed once per tick (after 'dt' is set for the
+    // tick), so the actions that are recorded are exactly the ones stepped.
+    const ssn::actions_t cActions = game::actions( pState, pInput );
+    ssn::recorder::record( cActions );
+    const bool32_t cStepStatus = game::step( pState, cActions, pDT, nullptr, &events );
+
+    // NOTE(JRC): Inputs only count as applied once they reach the paddles,
+    // which doesn't happen during hit stops or on the frame a round ends.
+    if( events.mInputsApplied ) { ssn::latency::apply(); }
+
+    for( uint32_t eventIdx = 0; eventIdx < events.mCount; eventIdx++ ) {
+        const game::events_t::event_t& cEvent = events.mEvents[eventIdx];
+        if( cEvent.mType == ssn::telemetry::event::hit ) {
+            ssn::telemetry::hit( pState->tt, cEvent.mSubjects[0], cEvent.mSubjects[1],
+                cEvent.mTeam, cEvent.mPos );
+            ssn::mixer::play( ssn::mixer::sound::hit, cEvent.mPos.x );
+        } else if( cEvent.mType == ssn::telemetry::event::claim ) {
+            ssn::telemetry::claim( pState->tt, cEvent.mSubjects[0], cEvent.mTeam );
+            ssn::mixer::play( ssn::mixer::sound::claim,
+                (cEvent.mTeam == ssn::team::left) ? 0.25f : 0.75f );
+        } else if( cEvent.mType == ssn::telemetry::event::rush ) {
+            ssn::telemetry::rush( pState->tt, cEvent.mSubjects[0], cEvent.mTeam, cEvent.mPos );
+            ssn::mixer::play( ssn::mixer::sound::rush, cEvent.mPos.x, 0.5f );
+        } else if( cEvent.mType == ssn::telemetry::event::wrap ) {
+            ssn::telemetry::wrap( pState->tt, cEvent.mSubjects[0], cEvent.mDirection, cEvent.mPos );
+        }
+    }
+    LLCE_CHECK_WARNING( events.mDropped == 0,
+        "Game event sink overflowed; " << events.mDropped << " events weren't reported." );
+
+    if( events.mRoundEnded ) { ssn::mixer::play( ssn::mixer::sound::end ); }
+
+    return cStepStatus;
+}
+
+
+static void report( ssn::mode::game::events_t* pEvents, const ssn::telemetry::event_e pType,
+        const uint8_t pTeam, const uint32_t pSubject0, const uint32_t pSubject1,
+        const vec2f32_t& pPos, const vec2i8_t& pDirection = vec2i8_t(0, 0) ) {
+    if( pEvents == nullptr ) {
+        return;
+    } else if( pEvents->mCount >= ssn::mode::game::events_t::MAX_EVENT_COUNT ) {
+        pEvents->mDropped++;
+        return;
+    }
+
+    ssn::mode::game::events_t::event_t& event = pEvents->mEvents[pEvents->mCount++];
+    event.mType = static_cast<uint8_t>( pType );
+    event.mTeam = pTeam;
+    event.mSubjects[0] = static_cast<uint16_t>( pSubject0 );
+    event.mSubjects[1] = static_cast<uint16_t>( pSubject1 );
+    event.mDirection = pDirection;
+    event.mPos = pPos;
+}
+
+
+// NOTE(JRC): The simulation step is specialized per stage so that the container
+// bounds used by the entity kernels (wrapping, containment, hits) are constants;
+// 'game::step' dispatches to the instance for the current stage.
+template <ssn::stage_e S>
+bool32_t game_step( ssn::state_t* pState, const ssn::actions_t& pActions, const float64_t pDT,
+        ssn::heatmap_t* pHeatmap, ssn::mode::game::events_t* pEvents ) {
     vec2i32_t moveInputs[2] = { {0.0f, 0.0f}, {0.0f, 0.0f} };
     bool32_t rushInputs[2] = { false, false };
 
     { // Input Processing //
         for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
-            if( pInput->isDownAct(TEAM_UP_ACTIONS[team]) ) {
+            if( pActions.down & (1 << TEAM_UP_ACTIONS[team]) ) {
                 moveInputs[team].y += 1;
-            } if( pInput->isDownAct(TEAM_DOWN_ACTIONS[team]) ) {
+            } if( pActions.down & (1 << TEAM_DOWN_ACTIONS[team]) ) {
                 moveInputs[team].y -= 1;
-            } if( pInput->isDownAct(TEAM_LEFT_ACTIONS[team]) ) {
+            } if( pActions.down & (1 << TEAM_LEFT_ACTIONS[team]) ) {
                 moveInputs[team].x -= 1;
-            } if( pInput->isDownAct(TEAM_RIGHT_ACTIONS[team]) ) {
+            } if( pActions.down & (1 << TEAM_RIGHT_ACTIONS[team]) ) {
                 moveInputs[team].x += 1;
             }
 
-            if( pInput->isPressedAct(TEAM_GO_ACTIONS[team]) ) {
+            if( pActions.pressed & (1 << TEAM_GO_ACTIONS[team]) ) {
                 rushInputs[team] = true;
             }
         }
     }
 
     ssn::bounds_t* const bounds = &pState->bounds;
-    ssn::puck_t* const puck = &pState->puck;
+    ssn::puck_t* const pucks = &pState->pucks[0];
     ssn::paddle_t* const paddles = &pState->paddles[0];
     ssn::particulator_t* const particulator = &pState->particulator;
 
     { // Game State Update //
-        const bool32_t cPaddleWasRushing[2] = { paddles[0].mAmRushing, paddles[1].mAmRushing };
+        bool8_t paddleWasRushing[ssn::MAX_PADDLE_COUNT];
+        for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+            paddleWasRushing[paddleIdx] = paddles[paddleIdx].mAmRushing;
+        }
 
         // NOTE(JRC): This is handled a bit clumsily so that we recognize round
         // ends the frame they happen instead of a frame late.
@@ -238,36 +508,72 @@ bool32_t game::update( ssn::state_t* pState, ssn::input_t* pInput, const float64
             pState->ht = ( pState->ht < ssn::HIT_DURATION ) ? pState->ht + pDT : 0.0;
         } else if( pState->rt >= ssn::ROUND_DURATION ) {
             pState->pmode = ssn::mode::score::ID;
+            if( pEvents != nullptr ) { pEvents->mRoundEnded = true; }
         } else {
-            for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
-                paddles[team].move( moveInputs[team].x, moveInputs[team].y );
-                if( rushInputs[team] ) { paddles[team].rush(); }
+            // NOTE(JRC): All of a team's paddles are driven by that team's
+            // inputs, so large formats move as coordinated squads.
+            for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+                const uint8_t cTeam = paddleIdx % 2;
+                paddles[paddleIdx].move( moveInputs[cTeam].x, moveInputs[cTeam].y );
+                if( rushInputs[cTeam] ) { paddles[paddleIdx].rush(); }
+                paddles[paddleIdx].update( pDT );
+            }
+            if( pEvents != nullptr ) { pEvents->mInputsApplied = true; }
+
+            pState->entities.integrate( pDT );
+            for( uint32_t puckIdx = 0; puckIdx < pState->puckCount; puckIdx++ ) {
+                const vec2i8_t cPrevWrapCount = pucks[puckIdx].mWrapCount;
+                pucks[puckIdx].resolve<S>( pDT );
+                if( pucks[puckIdx].mWrapCount != cPrevWrapCount ) {
+                    report( pEvents, ssn::telemetry::event::wrap, pucks[puckIdx].team(),
+                        puckIdx, 0, ssn::real::tof(pucks[puckIdx].pos()),
+                        pucks[puckIdx].mWrapCount - cPrevWrapCount );
+                }
+            } for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+                paddles[paddleIdx].resolve<S>( pDT );
             }
 
-            bounds->update( pDT );
-            puck->update( pDT );
-            paddles[ssn::team::left].update( pDT );
-            paddles[ssn::team::right].update( pDT );
-
-            for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
-                ssn::paddle_t* const paddle = &paddles[team];
-                if( puck->hit(paddle) ) {
+            const uint32_t cPairCount = pState->broadphase.collide(
+                pucks, paddles, bounds->mBBox, pDT );
+            for( uint32_t pairIdx = 0; pairIdx < cPairCount; pairIdx++ ) {
+                const ssn::broadphase_t::pair_t& pair = pState->broadphase.mPairs[pairIdx];
+                ssn::puck_t* const puck = &pucks[pair.mPuck];
+                ssn::paddle_t* const paddle = &paddles[pair.mPaddle];
+                if( puck->hit<S>(paddle, pDT) ) {
+                    const uint32_t cPrevAreaCount = bounds->mAreaCount;
                     bounds->claim( paddle );
-                    particulator->genHit(
-                        puck->mBounds.mCenter, puck->mVel, 2.25f * puck->mBounds.mRadius );
-                    pState->ht += pDT;
+                    report( pEvents, ssn::telemetry::event::hit, paddle->team(),
+                        pair.mPuck, pair.mPaddle, ssn::real::tof(puck->pos()) );
+                    if( pHeatmap != nullptr ) { pHeatmap->hit( puck->pos() ); }
+                    if( bounds->mAreaCount != cPrevAreaCount ) {
+                        report( pEvents, ssn::telemetry::event::claim,
+                            bounds->mAreaTeams[cPrevAreaCount], cPrevAreaCount, 0,
+                            ssn::real::tof(puck->pos()) );
+                    }
+                    particulator->genHit( ssn::real::tof(puck->pos()),
+                        ssn::real::tof(puck->vel()), 2.25f * ssn::real::tof(puck->radius()) );
+                    // NOTE(JRC): Hit pauses only make sense when there's a single
+                    // puck in play; large formats would be paused constantly.
+                    pState->ht += ( pState->puckCount == 1 ) ? pDT : 0.0;
 
                     // NOTE(JRC): If an area is claimed as a result of this hit, we
                     // slow down the puck again in preparation for the next rally.
                     if( bounds->mCurrAreaTeam == ssn::team::neutral ) {
                         const float32_t cVolleyCount = glm::max( 1.0f, bounds->mCurrAreaCount + 0.0f );
-                        const vec2f32_t cVolleyDir = llce::util::normalize( puck->mVel );
-                        puck->mVel = cVolleyDir *
-                            ssn::puck_t::MIN_VEL * cVolleyCount * ssn::puck_t::VEL_MULTIPLIER;
+                        const vec2r_t cVolleyDir = ssn::real::normalize( puck->vel() );
+                        puck->vel() = cVolleyDir * ssn::real::tor(
+                            ssn::puck_t::MIN_VEL * cVolleyCount * ssn::puck_t::VEL_MULTIPLIER );
                     }
-                } if( !cPaddleWasRushing[team] && paddle->mAmRushing ) {
-                    particulator->genTrail(
-                        paddle->mBounds.mCenter, paddle->mVel, 2.0f * paddle->mBounds.mRadius );
+                }
+            }
+
+            for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+                ssn::paddle_t* const paddle = &paddles[paddleIdx];
+                if( !paddleWasRushing[paddleIdx] && paddle->mAmRushing ) {
+                    report( pEvents, ssn::telemetry::event::rush, paddle->team(),
+                        paddleIdx, 0, ssn::real::tof(paddle->pos()) );
+                    particulator->genTrail( ssn::real::tof(paddle->pos()),
+                        ssn::real::tof(paddle->vel()), 2.0f * ssn::real::tof(paddle->radius()) );
                 }
             }
         }
@@ -278,6 +584,20 @@ bool32_t game::update( ssn::state_t* pState, ssn::input_t* pInput, const float64
     return true;
 }
 
+constexpr static step_f GAME_STEP_FUNS[] = {
+    game_step<ssn::stage::box>, game_step<ssn::stage::vert>,
+    game_step<ssn::stage::horz>, game_step<ssn::stage::wild> };
+static_assert( LLCE_ELEM_COUNT(GAME_STEP_FUNS) == ssn::stage_e::_length,
+    "Incorrect number of stage-specialized steps; "
+    "please add a 'game_step' instance for all stages in enumeration "
+    "'ssn::stage::stage_e' to the array 'GAME_STEP_FUNS' in 'ssn_modes.cpp'." );
+
+
+bool32_t game::step( ssn::state_t* pState, const ssn::actions_t& pActions, const float64_t pDT,
+        ssn::heatmap_t* pHeatmap, game::events_t* pEvents ) {
+    return GAME_STEP_FUNS[pState->sid]( pState, pActions, pDT, pHeatmap, pEvents );
+}
+
 
 bool32_t game::render( const ssn::state_t* pState, const ssn::input_t* pInput, const ssn::output_t* pOutput ) {
     gameboard_render( pState, pInput, pOutput );
@@ -309,19 +629,25 @@ bool32_t select::update( ssn::state_t* pState, ssn::input_t* pInput, const float
             menuInput.x += 1;
         }
 
-        if( pInput->isPressedAct(&TEAM_GO_ACTIONS[0]) ) {
+        // NOTE(JRC): Either team can navigate the menu, but only the left
+        // team's rush confirms it; the right team's rush instead toggles
+        // whether that team is played by a bot (i.e. single player rounds).
+        if( pInput->isPressedAct(TEAM_GO_ACTIONS[ssn::team::left]) ) {
             menuSelected = true;
+        } if( pInput->isPressedAct(TEAM_GO_ACTIONS[ssn::team::right]) ) {
+            pState->selectBotTeams ^= ( 1 << ssn::team::right );
         }
     }
 
     int32_t newSelectMenuIndex = pState->selectMenuIndex +
         ( SELECT_ITEM_DIMS.x * menuInput.y ) + menuInput.x;
-    if( newSelectMenuIndex >= 0 && newSelectMenuIndex < ssn::stage::_length ) {
+    if( newSelectMenuIndex >= 0 && newSelectMenuIndex < ssn::stage::_length * ssn::format::_length ) {
         pState->selectMenuIndex = static_cast<int8_t>( newSelectMenuIndex );
     }
 
     if( menuSelected ) {
-        pState->sid = static_cast<ssn::stage_e>( pState->selectMenuIndex );
+        pState->sid = static_cast<ssn::stage_e>( pState->selectMenuIndex % ssn::stage::_length );
+        pState->fid = static_cast<ssn::format_e>( pState->selectMenuIndex / ssn::stage::_length );
         pState->pmode = ssn::mode::game::ID;
     }
 
@@ -336,14 +662,19 @@ bool32_t select::render( const ssn::state_t* pState, const ssn::input_t* pInput,
     const static llce::box_t csHeaderArea( 0.0f, 0.5f, 1.0f, 0.5f );
     const static llce::box_t csItemArea( 0.0f, 0.0f, 1.0f, 0.5f );
 
-    const static auto csRenderStagePreview = [] ( const uint32_t pStage ) {
+    const static auto csRenderStagePreview = [] ( const uint32_t pItem ) {
         const static float32_t csRenderPadding = 5.0e-2f;
         const static float32_t csPreviewDim = 1.0f - 2.0f * csRenderPadding;
         const static llce::box_t csPaddedBox(
             0.5f, 0.5f, csPreviewDim, csPreviewDim, llce::geom::anchor2D::mm );
 
-        const vec2f32_t cStageDims = ssn::STAGE_SPECS[pStage];
-        const char8_t* cStageName = &ssn::STAGE_NAMES[pStage][0];
+        const uint32_t cStage = pItem % ssn::stage::_length;
+        const uint32_t cFormat = pItem / ssn::stage::_length;
+        const vec2f32_t cStageDims = ssn::STAGE_SPECS[cStage];
+
+        char8_t stageName[16];
+        std::snprintf( &stageName[0], sizeof(stageName), "%s%s",
+            &ssn::STAGE_NAMES[cStage][0], &ssn::FORMAT_TAGS[cFormat][0] );
 
         llce::gfx::color_context_t stageCC( &ssn::color::TEAM[ssn::team::neutral] );
         llce::gfx::render::box();
@@ -357,7 +688,7 @@ bool32_t select::render( const ssn::state_t* pState, const ssn::input_t* pInput,
             vec2f32_t(0.5f, 0.5f), cStageDims, llce::geom::anchor2D::mm) );
 
         stageCC.update( &ssn::color::INFOLL );
-        llce::gfx::render::text( cStageName, csPaddedBox );
+        llce::gfx::render::text( &stageName[0], csPaddedBox );
     };
 
     { // Header //
@@ -366,6 +697,12 @@ bool32_t select::render( const ssn::state_t* pState, const ssn::input_t* pInput,
             0.5f, 0.5f, 1.0f - csSectionPadding, 1.0f - csSectionPadding,
             llce::geom::anchor2D::mm), 1.0f );
         csRenderStagePreview( pState->selectMenuIndex );
+
+        if( pState->selectBotTeams & (1 << ssn::team::right) ) {
+            selectCC.update( &ssn::color::TEAM[ssn::team::right] );
+            llce::gfx::render::text( "CPU", llce::box_t(
+                1.0f, 1.0f, 0.2f, 0.1f, llce::geom::anchor2D::hh) );
+        }
     }
 
     { // Items //
@@ -386,7 +723,7 @@ bool32_t select::render( const ssn::state_t* pState, const ssn::input_t* pInput,
                     llce::gfx::render::box( cItemBox );
                 }
 
-                if( itemIdx < ssn::stage::_length ) {
+                if( itemIdx < ssn::stage::_length * ssn::format::_length ) {
                     llce::gfx::render_context_t itemRC( llce::box_t(
                         cItemBox.mid(), csItemPaddedDims, llce::geom::anchor2D::mm) );
                     csRenderStagePreview( itemIdx );
@@ -401,8 +738,11 @@ bool32_t select::render( const ssn::state_t* pState, const ssn::input_t* pInput,
 /// 'ssn::mode::title' Functions  ///
 
 bool32_t title::init( ssn::state_t* pState, ssn::input_t* pInput ) {
+    ssn::scratch::title_t* scratch = ssn::scratch::acquire<ssn::scratch::title_t>( pState );
+    if( scratch == nullptr ) { return false; }
+
     auto cTitleItems = llce::util::pointerize( TITLE_ITEM_TEXT );
-    pState->titleMenu = llce::gui::menu_t(
+    scratch->menu = llce::gui::menu_t(
         pInput, &MENU_ACTIONS[0],
         "SSN", cTitleItems.data(), cTitleItems.size(),
         &ssn::color::BACKGROUND,
@@ -414,14 +754,15 @@ bool32_t title::init( ssn::state_t* pState, ssn::input_t* pInput ) {
 
 
 bool32_t title::update( ssn::state_t* pState, ssn::input_t* pInput, const float64_t pDT ) {
-    pState->titleMenu.update( pDT );
+    llce::gui::menu_t& menu = ssn::scratch::get<ssn::scratch::title_t>( pState )->menu;
+    menu.update( pDT );
 
-    if( pState->titleMenu.changed(llce::gui::event::select) ) {
-        if( pState->titleMenu.mItemIndex == 0 ) {
+    if( menu.changed(llce::gui::event::select) ) {
+        if( menu.mItemIndex == 0 ) {
             pState->pmode = ssn::mode::select::ID;
-        } else if( pState->titleMenu.mItemIndex == 1 ) {
+        } else if( menu.mItemIndex == 1 ) {
             pState->pmode = ssn::mode::bind::ID;
-        } else if( pState->titleMenu.mItemIndex == 2 ) {
+        } else if( menu.mItemIndex == 2 ) {
             pState->pmode = ssn::mode::exit::ID;
         }
     }
@@ -430,7 +771,9 @@ bool32_t title::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
 }
 
 bool32_t title::render( const ssn::state_t* pState, const ssn::input_t* pInput, const ssn::output_t* pOutput ) {
-    pState->titleMenu.render();
+    const ssn::scratch::title_t* scratch = ssn::scratch::get<ssn::scratch::title_t>( pState );
+    if( scratch == nullptr ) { return false; }
+    scratch->menu.render();
 
     return true;
 }
@@ -438,8 +781,11 @@ bool32_t title::render( const ssn::state_t* pState, const ssn::input_t* pInput,
 /// 'ssn::mode::bind' Functions  ///
 
 bool32_t bind::init( ssn::state_t* pState, ssn::input_t* pInput ) {
+    ssn::scratch::bind_t* scratch = ssn::scratch::acquire<ssn::scratch::bind_t>( pState );
+    if( scratch == nullptr ) { return false; }
+
     auto cActionTitles = llce::util::pointerize( ssn::ACTION_NAMES );
-    pState->bindMenu = llce::gui::bind_menu_t(
+    scratch->menu = llce::gui::bind_menu_t(
         pInput, &MENU_ACTIONS[0],
         cActionTitles.data(), cActionTitles.size(),
         &ssn::color::BACKGROUND,
@@ -452,10 +798,11 @@ bool32_t bind::init( ssn::state_t* pState, ssn::input_t* pInput ) {
 
 
 bool32_t bind::update( ssn::state_t* pState, ssn::input_t* pInput, const float64_t pDT ) {
-    pState->bindMenu.update( pDT );
+    llce::gui::bind_menu_t& menu = ssn::scratch::get<ssn::scratch::bind_t>( pState )->menu;
+    menu.update( pDT );
 
-    if( pState->bindMenu.changed(llce::gui::event::select) ) {
-        if( pState->bindMenu.mItemIndex == pState->bindMenu.mItemCount - 1 ) {
+    if( menu.changed(llce::gui::event::select) ) {
+        if( menu.mItemIndex == menu.mItemCount - 1 ) {
             pState->pmode = ssn::mode::title::ID;
         }
     }
@@ -464,7 +811,9 @@ bool32_t bind::update( ssn::state_t* pState, ssn::input_t* pInput, const float64
 }
 
 bool32_t bind::render( const ssn::state_t* pState, const ssn::input_t* pInput, const ssn::output_t* pOutput ) {
-    pState->bindMenu.render();
+    const ssn::scratch::bind_t* scratch = ssn::scratch::get<ssn::scratch::bind_t>( pState );
+    if( scratch == nullptr ) { return false; }
+    scratch->menu.render();
 
     return true;
 }
@@ -473,17 +822,18 @@ bool32_t bind::render( const ssn::state_t* pState, const ssn::input_t* pInput, c
 
 bool32_t score::init( ssn::state_t* pState, ssn::input_t* pInput ) {
     std::memset( &pState->scoreTotals[0], 0, sizeof(pState->scoreTotals) );
-    std::memset( &pState->scoreSamples[0], 0, sizeof(pState->scoreSamples) );
-    pState->scoreTallied = false;
 
-    return true;
+    // NOTE(JRC): Scratch memory is zeroed on acquisition, which clears the
+    // samples and tally state.
+    return ssn::scratch::acquire<ssn::scratch::score_t>( pState ) != nullptr;
 }
 
 
 bool32_t score::update( ssn::state_t* pState, ssn::input_t* pInput, const float64_t pDT ) {
     const static auto csUpdateIntro = []
             ( ssn::state_t* pState, ssn::input_t* pInput, const float64_t pDT, const float64_t pPT ) -> bool32_t  {
-        if( pPT > SCORE_PHASE_DURATIONS[0] / 10.0 && !pState->scoreTallied ) {
+        ssn::scratch::score_t* scratch = ssn::scratch::get<ssn::scratch::score_t>( pState );
+        if( pPT > SCORE_PHASE_DURATIONS[0] / 10.0 && !scratch->tallied ) {
             ssn::bounds_t* const bounds = &pState->bounds;
             const uint32_t cAreaLength = bounds_t::AREA_CORNER_COUNT;
             // NOTE(JRC): The global bounds of the game space are used instead of
@@ -492,7 +842,7 @@ bool32_t score::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
             const llce::interval_t xbounds( 0.0f, 1.0f ); // = bounds->mBBox.xbounds();
             const llce::interval_t ybounds( 0.0f, 1.0f ); // = bounds->mBBox.ybounds();
 
-            bit8_t* scores = &pState->scoreSamples[0];
+            bit8_t* scores = &scratch->samples[0];
             for( uint32_t yIdx = 0, sIdx = 0; yIdx < SCORE_SAMPLE_RES.y; yIdx++ ) {
                 for( uint32_t xIdx = 0; xIdx < SCORE_SAMPLE_RES.x; xIdx++, sIdx++ ) {
                     uint32_t sampleIdx = sIdx / SCORE_SAMPLES_PER_BYTE;
@@ -512,7 +862,7 @@ bool32_t score::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
                 }
             }
 
-            pState->scoreTallied = true;
+            scratch->tallied = true;
         }
 
         return true;
@@ -523,6 +873,8 @@ bool32_t score::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
         const static float64_t csTallyDY = 1.0 / ssn::SCORE_SAMPLE_RES.y;
         const static float64_t csTallyDA = csTallyDX * csTallyDY;
 
+        ssn::scratch::score_t* scratch = ssn::scratch::get<ssn::scratch::score_t>( pState );
+
         const float64_t cPrevBasePos = 0.5 * glm::max( (pPT - pDT) / SCORE_PHASE_DURATIONS[1], 0.0 );
         const float64_t cCurrBasePos = 0.5 * glm::min( pPT / SCORE_PHASE_DURATIONS[1], 1.0 );
 
@@ -537,7 +889,15 @@ bool32_t score::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
             const float64_t cTallyMin = glm::min( prevTallyPos, currTallyPos );
             const float64_t cTallyMax = glm::max( prevTallyPos, currTallyPos );
 
-            pState->tallyPoss[tallyIdx] = currTallyPos + csTallyDX / 2.0;
+            scratch->tallyPoss[tallyIdx] = currTallyPos + csTallyDX / 2.0;
+
+            const int32_t cTallyEdgeIdx = tallyIdx ?
+                static_cast<int32_t>( glm::ceil(currTallyPos / csTallyDX) ) :
+                static_cast<int32_t>( glm::floor(currTallyPos / csTallyDX) ) + 1;
+            const int32_t cTallyColumns = tallyIdx ?
+                static_cast<int32_t>( SCORE_SAMPLE_RES.x ) - cTallyEdgeIdx : cTallyEdgeIdx;
+            scratch->tallyColumns[tallyIdx] = static_cast<uint32_t>(
+                glm::clamp(cTallyColumns, 0, static_cast<int32_t>(SCORE_SAMPLE_RES.x)) );
 
             // NOTE(JRC): Consider offsetting these values by the play space
             // boundaries (i.e. bounds->mBBox.{x|y}bounds()) in order to keep
@@ -552,7 +912,7 @@ bool32_t score::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
                     uint32_t sampleIdx = sIdx / SCORE_SAMPLES_PER_BYTE;
                     uint32_t sampleOffset = SCORE_SAMPLE_BITS * ( sIdx % SCORE_SAMPLES_PER_BYTE );
 
-                    uint8_t sampleData = ( pState->scoreSamples[sampleIdx] >> sampleOffset ) & 0b11;
+                    uint8_t sampleData = ( scratch->samples[sampleIdx] >> sampleOffset ) & 0b11;
                     for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
                         if( sampleData & (1 << team) ) {
                             pState->scoreTotals[team] += csTallyDA;
@@ -604,6 +964,11 @@ bool32_t score::render( const ssn::state_t* pState, const ssn::input_t* pInput,
     };
     const static auto csRenderTally = []
             ( const ssn::state_t* pState, const ssn::input_t* pInput, const ssn::output_t* pOutput ) -> bool32_t  {
+        const ssn::scratch::score_t* scratch = ssn::scratch::get<ssn::scratch::score_t>( pState );
+        if( scratch == nullptr ) { return false; }
+
+        ownership_render( pState, scratch );
+
         llce::gfx::color_context_t tallyCC( &ssn::color::INFOLL );
 
         { // Render Tally Regions //
@@ -612,14 +977,14 @@ bool32_t score::render( const ssn::state_t* pState, const ssn::input_t* pInput,
             for( uint32_t tallyIdx = 0; tallyIdx < 2; tallyIdx++ ) {
                 tallyCC.update( &ssn::color::INFOLL );
                 llce::gfx::render::box( llce::box_t(
-                    pState->tallyPoss[tallyIdx], 0.0f, 1.0f, 1.0f,
+                    scratch->tallyPoss[tallyIdx], 0.0f, 1.0f, 1.0f,
                     tallyIdx ? llce::geom::anchor2D::ll : llce::geom::anchor2D::hl) );
 
                 tallyCC.update( &ssn::color::INFOL );
-                float32_t tallyMidDist = glm::abs( pState->tallyPoss[tallyIdx] - 0.5f );
+                float32_t tallyMidDist = glm::abs( scratch->tallyPoss[tallyIdx] - 0.5f );
                 if( tallyMidDist > csTallyWidth ) {
                     llce::gfx::render::box( llce::box_t(
-                        pState->tallyPoss[tallyIdx], 0.0f,
+                        scratch->tallyPoss[tallyIdx], 0.0f,
                         csTallyWidth, csTallyHeight, llce::geom::anchor2D::ml) );
                 } else {
                     llce::gfx::render::box( llce::box_t(
@@ -696,31 +1061,35 @@ bool32_t score::render( const ssn::state_t* pState, const ssn::input_t* pInput,
 /// 'ssn::mode::reset' Functions  ///
 
 bool32_t reset::init( ssn::state_t* pState, ssn::input_t* pInput ) {
+    ssn::scratch::reset_t* scratch = ssn::scratch::acquire<ssn::scratch::reset_t>( pState );
+    if( scratch == nullptr ) { return false; }
+
     auto cResetItems = llce::util::pointerize( RESET_ITEM_TEXT );
-    pState->resetMenu = llce::gui::menu_t(
+    scratch->menu = llce::gui::menu_t(
         pInput, &MENU_ACTIONS[0],
         "GAME!", cResetItems.data(), cResetItems.size(),
         &ssn::color::BACKGROUND,
         &ssn::color::FOREGROUND,
         &ssn::color::TEAM[ssn::team::neutral] );
-    pState->resetMenuUpdated = false;
+    scratch->updated = false;
 
     return true;
 }
 
 
 bool32_t reset::update( ssn::state_t* pState, ssn::input_t* pInput, const float64_t pDT ) {
-    pState->resetMenu.update( pDT );
+    ssn::scratch::reset_t* scratch = ssn::scratch::get<ssn::scratch::reset_t>( pState );
+    scratch->menu.update( pDT );
 
-    if( pState->resetMenu.changed(llce::gui::event::select) ) {
-        if( pState->resetMenu.mItemIndex == 0 ) {
+    if( scratch->menu.changed(llce::gui::event::select) ) {
+        if( scratch->menu.mItemIndex == 0 ) {
             pState->pmode = ssn::mode::select::ID;
-        } else if( pState->resetMenu.mItemIndex == 1 ) {
+        } else if( scratch->menu.mItemIndex == 1 ) {
             pState->pmode = ssn::mode::title::ID;
         }
     }
 
-    if( !pState->resetMenuUpdated ) { // Set Render Header Based on Winner //
+    if( !scratch->updated ) { // Set Render Header Based on Winner //
         const float32_t* cScores = &pState->scoreTotals[0];
         const char8_t cTeamNames[3][8] = { "LEFT", "RIGHT", "NOBODY" };
         const auto cTeamWinner = (
@@ -733,9 +1102,9 @@ bool32_t reset::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
             "%s WINS!", &cTeamNames[cTeamWinner][0] );
         const color4u8_t* headerColor = &ssn::color::TEAM[cTeamWinner];
 
-        std::strcpy( &pState->resetMenu.mTitle[0], &headerText[0] );
-        pState->resetMenu.mColorText = headerColor;
-        pState->resetMenuUpdated = true;
+        std::strcpy( &scratch->menu.mTitle[0], &headerText[0] );
+        scratch->menu.mColorText = headerColor;
+        scratch->updated = true;
     }
 
     return true;
@@ -743,7 +1112,9 @@ bool32_t reset::update( ssn::state_t* pState, ssn::input_t* pInput, const float6
 
 
 bool32_t reset::render( const ssn::state_t* pState, const ssn::input_t* pInput, const ssn::output_t* pOutput ) {
-    pState->resetMenu.render();
+    const ssn::scratch::reset_t* scratch = ssn::scratch::get<ssn::scratch::reset_t>( pState );
+    if( scratch == nullptr ) { return false; }
+    scratch->menu.render();
 
     return true;
 }
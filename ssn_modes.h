@@ -2,12 +2,16 @@
 #define SSN_MODES_T_H
 
 #include "ssn.h"
+#include "ssn_heatmap_t.h"
+#include "ssn_telemetry.h"
 #include "ssn_consts.h"
 #include "consts.h"
 
 namespace ssn {
 
 namespace mode {
+    ssn::actions_t capture( ssn::input_t* );
+
     namespace boot { constexpr static mode_e ID = -1; }
     namespace exit { constexpr static mode_e ID = -2; }
 
@@ -16,6 +20,42 @@ namespace mode {
         bool32_t init( ssn::state_t*, ssn::input_t* );
         bool32_t update( ssn::state_t*, ssn::input_t*, const float64_t );
         bool32_t render( const ssn::state_t*, const ssn::input_t*, const ssn::output_t* );
+
+        // NOTE(JRC): Events of a single 'step', which are reported to the caller
+        // (rather than to process-wide systems like telemetry) so that 'step'
+        // only ever touches the given state and sinks; this keeps it safe to run
+        // concurrently on many states (e.g. in 'ssn::runner_t' and 'ssn_env')
+        // and to re-run ticks (e.g. in 'ssn::rollback_t'). Events past the
+        // capacity are counted but not recorded.
+        struct events_t {
+            constexpr static uint32_t MAX_EVENT_COUNT = 256;
+
+            struct event_t {
+                uint8_t mType;         // units: 'ssn::telemetry::event_e'
+                uint8_t mTeam;
+                uint16_t mSubjects[2]; // units: event-specific indices (e.g. puck, paddle)
+                vec2i8_t mDirection;   // units: wrap direction ('wrap' events only)
+                vec2f32_t mPos;        // units: world
+            };
+
+            event_t mEvents[MAX_EVENT_COUNT];
+            uint32_t mCount;
+            uint32_t mDropped;
+            bool32_t mInputsApplied; // whether the step's inputs reached the paddles
+            bool32_t mRoundEnded;    // whether the step ended the round
+        };
+
+        // NOTE(JRC): Returns the actions 'update' applies for the given input,
+        // i.e. the captured input combined with the actions of each team that's
+        // played by a bot (see 'ssn::state_t::selectBotTeams').
+        ssn::actions_t actions( const ssn::state_t*, ssn::input_t* );
+
+        // NOTE(JRC): Input-free simulation step for headless drivers (e.g.
+        // 'ssn::runner_t'); 'update' is a thin wrapper around this function.
+        // Hit locations are recorded into the given heatmap (if any) and
+        // events into the given event sink (if any).
+        bool32_t step( ssn::state_t*, const ssn::actions_t&, const float64_t,
+            ssn::heatmap_t* = nullptr, events_t* = nullptr );
     }
 
     namespace select {
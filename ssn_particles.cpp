@@ -132,7 +132,7 @@ void particle_t::renderTrail( const particle_t* pParticle ) {
 
 /// 'ssn::particulator_t' Functions ///
 
-particulator_t::particulator_t( llce::rng_t* const pRNG ) : mRNG( pRNG ) {
+particulator_t::particulator_t() {
     
 }
 
@@ -214,7 +214,7 @@ void particulator_t::genTrail( const vec2f32_t& pSource, const vec2f32_t& pDir,
     for( uint32_t partIdx = 0; partIdx < cPartCount; partIdx++ ) {
         float32_t partFrac = ( partIdx + 0.0f ) / ( cPartCount - 1.0f );
         float32_t partU = cUInt.interp( partFrac );
-        float32_t partV = cVInt.interp( 0.5f ); // mRNG->nextf() );
+        float32_t partV = cVInt.interp( 0.5f );
 
         vec2f32_t partBasisY = ( pSize / (csMaxPartCount + 0.0f) ) *
             glm::normalize( pTrailV );
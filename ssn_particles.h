@@ -76,7 +76,7 @@ class particulator_t {
 
     /// Constructors ///
 
-    particulator_t( llce::rng_t* pRNG );
+    particulator_t();
 
     /// Class Functions ///
 
@@ -96,7 +96,6 @@ class particulator_t {
 
     public:
 
-    llce::rng_t* mRNG;
     llce::deque<particle_t, MAX_PARTICLE_COUNT> mParticles;
 };
 
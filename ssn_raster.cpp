@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "ssn_wrap.h"
+#include "ssn_raster.h"
+
+namespace ssn {
+
+namespace raster {
+
+/// Helper Types ///
+
+// NOTE(JRC): Each cover type tests whether cell centers lie inside of a shape;
+// 'cover4' tests four adjacent cells in a row at once (returning an all-ones
+// lane for each covered cell) and 'cover1' is the equivalent scalar test.
+
+struct triangle_cover_t {
+    float32_t mEdges[3][3]; // units: (a, b, c) of edge functions 'a*x + b*y + c >= 0'
+
+    bool32_t init( const vec2f32_t* pCorners ) {
+        const float32_t cArea =
+            ( pCorners[1].x - pCorners[0].x ) * ( pCorners[2].y - pCorners[0].y ) -
+            ( pCorners[2].x - pCorners[0].x ) * ( pCorners[1].y - pCorners[0].y );
+        const float32_t cWinding = ( cArea < 0.0f ) ? -1.0f : 1.0f;
+        for( uint32_t edgeIdx = 0; edgeIdx < 3; edgeIdx++ ) {
+            const vec2f32_t& cFrom = pCorners[edgeIdx];
+            const vec2f32_t& cTo = pCorners[( edgeIdx + 1 ) % 3];
+            mEdges[edgeIdx][0] = cWinding * -( cTo.y - cFrom.y );
+            mEdges[edgeIdx][1] = cWinding * ( cTo.x - cFrom.x );
+            mEdges[edgeIdx][2] = cWinding * ( (cTo.y - cFrom.y) * cFrom.x - (cTo.x - cFrom.x) * cFrom.y );
+        }
+        return cArea != 0.0f;
+    }
+
+#if defined(__SSE2__)
+    __m128 cover4( const __m128 pXs, const float32_t pY ) const {
+        __m128 mask = _mm_castsi128_ps( _mm_set1_epi32(-1) );
+        for( uint32_t edgeIdx = 0; edgeIdx < 3; edgeIdx++ ) {
+            const __m128 cValues = _mm_add_ps(
+                _mm_mul_ps(_mm_set1_ps(mEdges[edgeIdx][0]), pXs),
+                _mm_set1_ps(mEdges[edgeIdx][1] * pY + mEdges[edgeIdx][2]) );
+            mask = _mm_and_ps( mask, _mm_cmpge_ps(cValues, _mm_setzero_ps()) );
+        }
+        return mask;
+    }
+#endif
+
+    bool32_t cover1( const float32_t pX, const float32_t pY ) const {
+        bool32_t isCovered = true;
+        for( uint32_t edgeIdx = 0; edgeIdx < 3; edgeIdx++ ) {
+            isCovered &= mEdges[edgeIdx][0] * pX + mEdges[edgeIdx][1] * pY + mEdges[edgeIdx][2] >= 0.0f;
+        }
+        return isCovered;
+    }
+};
+
+
+struct circle_cover_t {
+    vec2f32_t mCenter; // units: world
+    float32_t mRadiusSq; // units: world**2
+
+#if defined(__SSE2__)
+    __m128 cover4( const __m128 pXs, const float32_t pY ) const {
+        const __m128 cDXs = _mm_sub_ps( pXs, _mm_set1_ps(mCenter.x) );
+        const float32_t cDY = pY - mCenter.y;
+        const __m128 cDistSqs = _mm_add_ps( _mm_mul_ps(cDXs, cDXs), _mm_set1_ps(cDY * cDY) );
+        return _mm_cmple_ps( cDistSqs, _mm_set1_ps(mRadiusSq) );
+    }
+#endif
+
+    bool32_t cover1( const float32_t pX, const float32_t pY ) const {
+        const vec2f32_t cDelta = vec2f32_t( pX, pY ) - mCenter;
+        return cDelta.x * cDelta.x + cDelta.y * cDelta.y <= mRadiusSq;
+    }
+};
+
+/// Helper Functions ///
+
+static int32_t cell( const float32_t pCoord ) {
+    return std::min( std::max(static_cast<int32_t>(std::floor(pCoord * RESOLUTION)), 0),
+        static_cast<int32_t>(RESOLUTION) - 1 );
+}
+
+
+// NOTE(JRC): Fills the cells of the given channel that are covered by the
+// shape within the given world-space bounding box, and clears the same cells
+// in the (optional) opposing channel. With SSE2, cells are processed in
+// aligned runs of 16 so that four 4-lane masks pack into a single byte store.
+template <typename TCover>
+static void fill( const TCover& pCover, const vec2f32_t& pMin, const vec2f32_t& pMax,
+        uint8_t* pChannel, uint8_t* pOpposeChannel = nullptr ) {
+    const int32_t cYMin = cell( pMin.y ), cYMax = cell( pMax.y );
+    const float32_t cCellSize = 1.0f / RESOLUTION;
+
+#if defined(__SSE2__)
+    constexpr static int32_t csRunLength = 16;
+    const int32_t cXMin = cell( pMin.x ) / csRunLength * csRunLength;
+    const int32_t cXMax = cell( pMax.x );
+
+    for( int32_t yIdx = cYMin; yIdx <= cYMax; yIdx++ ) {
+        const float32_t cY = ( yIdx + 0.5f ) * cCellSize;
+        for( int32_t xIdx = cXMin; xIdx <= cXMax; xIdx += csRunLength ) {
+            __m128 masks[4];
+            for( int32_t laneIdx = 0; laneIdx < 4; laneIdx++ ) {
+                const float32_t cX = ( xIdx + 4 * laneIdx + 0.5f ) * cCellSize;
+                const __m128 cXs = _mm_add_ps( _mm_set1_ps(cX),
+                    _mm_set_ps(3.0f * cCellSize, 2.0f * cCellSize, 1.0f * cCellSize, 0.0f) );
+                masks[laneIdx] = pCover.cover4( cXs, cY );
+            }
+            const __m128i cRunMask = _mm_packs_epi16(
+                _mm_packs_epi32(_mm_castps_si128(masks[0]), _mm_castps_si128(masks[1])),
+                _mm_packs_epi32(_mm_castps_si128(masks[2]), _mm_castps_si128(masks[3])) );
+
+            __m128i* const cCells = reinterpret_cast<__m128i*>( &pChannel[yIdx * RESOLUTION + xIdx] );
+            _mm_storeu_si128( cCells, _mm_or_si128(_mm_loadu_si128(cCells), cRunMask) );
+            if( pOpposeChannel != nullptr ) {
+                __m128i* const cOpposeCells = reinterpret_cast<__m128i*>( &pOpposeChannel[yIdx * RESOLUTION + xIdx] );
+                _mm_storeu_si128( cOpposeCells, _mm_andnot_si128(cRunMask, _mm_loadu_si128(cOpposeCells)) );
+            }
+        }
+    }
+#else
+    const int32_t cXMin = cell( pMin.x ), cXMax = cell( pMax.x );
+
+    for( int32_t yIdx = cYMin; yIdx <= cYMax; yIdx++ ) {
+        const float32_t cY = ( yIdx + 0.5f ) * cCellSize;
+        for( int32_t xIdx = cXMin; xIdx <= cXMax; xIdx++ ) {
+            const uint8_t cCellMask = pCover.cover1( (xIdx + 0.5f) * cCellSize, cY ) ? 0xff : 0x00;
+            pChannel[yIdx * RESOLUTION + xIdx] |= cCellMask;
+            if( pOpposeChannel != nullptr ) {
+                pOpposeChannel[yIdx * RESOLUTION + xIdx] &= ~cCellMask;
+            }
+        }
+    }
+#endif
+}
+
+
+static void fill_circle( const vec2f32_t& pCenter, const float32_t pRadius, uint8_t* pChannel ) {
+    const circle_cover_t cCover = { pCenter, pRadius * pRadius };
+    fill( cCover, pCenter - vec2f32_t(pRadius), pCenter + vec2f32_t(pRadius), pChannel );
+}
+
+/// Functions ///
+
+static_assert( RESOLUTION % 16 == 0,
+    "Invalid raster resolution; please use a multiple of 16 for 'ssn::raster::RESOLUTION' "
+    "so that rows divide evenly into SIMD runs." );
+
+void render( const ssn::state_t* pState, uint8_t* pOutput ) {
+    std::memset( pOutput, 0, OUTPUT_BYTES );
+
+    const ssn::bounds_t* const bounds = &pState->bounds;
+    const llce::box_t& cBBox = bounds->mBBox;
+
+    { // Walls //
+        // NOTE(JRC): Cells with centers outside of the stage are walls; the
+        // stage is an axis-aligned box, so this is a fill plus a row-wise clear.
+        uint8_t* const wallChannel = &pOutput[channel::wall * CHANNEL_BYTES];
+        std::memset( wallChannel, 0xff, CHANNEL_BYTES );
+
+        const float32_t cCellSize = 1.0f / RESOLUTION;
+        const int32_t cXMin = static_cast<int32_t>( std::ceil(cBBox.min().x / cCellSize - 0.5f) );
+        const int32_t cXMax = static_cast<int32_t>( std::floor(cBBox.max().x / cCellSize - 0.5f) );
+        const int32_t cYMin = static_cast<int32_t>( std::ceil(cBBox.min().y / cCellSize - 0.5f) );
+        const int32_t cYMax = static_cast<int32_t>( std::floor(cBBox.max().y / cCellSize - 0.5f) );
+        for( int32_t yIdx = std::max(cYMin, 0); yIdx <= std::min(cYMax, int32_t(RESOLUTION) - 1); yIdx++ ) {
+            const int32_t cRowMin = std::max( cXMin, 0 ), cRowMax = std::min( cXMax, int32_t(RESOLUTION) - 1 );
+            if( cRowMin <= cRowMax ) {
+                std::memset( &wallChannel[yIdx * RESOLUTION + cRowMin], 0x00, cRowMax - cRowMin + 1 );
+            }
+        }
+    }
+
+    { // Areas //
+        uint8_t* const teamChannels[2] = {
+            &pOutput[channel::larea * CHANNEL_BYTES], &pOutput[channel::rarea * CHANNEL_BYTES] };
+        for( uint32_t areaIdx = 0; areaIdx < bounds->mAreaCount; areaIdx++ ) {
+            const uint8_t cAreaTeam = bounds->mAreaTeams[areaIdx];
+            const vec2f32_t* cAreaCorners = &bounds->mAreaCorners[areaIdx * ssn::bounds_t::AREA_CORNER_COUNT];
+
+            triangle_cover_t cover;
+            if( cAreaTeam > ssn::team::right || !cover.init(cAreaCorners) ) {
+                continue;
+            }
+
+            const vec2f32_t cAreaMin = glm::min( glm::min(cAreaCorners[0], cAreaCorners[1]), cAreaCorners[2] );
+            const vec2f32_t cAreaMax = glm::max( glm::max(cAreaCorners[0], cAreaCorners[1]), cAreaCorners[2] );
+            fill( cover, cAreaMin, cAreaMax, teamChannels[cAreaTeam], teamChannels[1 - cAreaTeam] );
+        }
+    }
+
+    { // Pucks //
+        uint8_t* const puckChannel = &pOutput[channel::puck * CHANNEL_BYTES];
+        const vec2f32_t& cWrapDims = cBBox.mDims;
+        for( uint32_t puckIdx = 0; puckIdx < pState->puckCount; puckIdx++ ) {
+            const ssn::puck_t& cPuck = pState->pucks[puckIdx];
+            const vec2f32_t cPuckPos = ssn::real::tof( cPuck.pos() );
+            const float32_t cPuckRadius = ssn::real::tof( cPuck.radius() );
+
+            vec2i8_t puckImages[ssn::wrap::MAX_IMAGE_COUNT];
+            const uint32_t cImageCount = ssn::wrap::images( cPuck.bbox(), cBBox, puckImages );
+            for( uint32_t imageIdx = 0; imageIdx < cImageCount; imageIdx++ ) {
+                fill_circle( cPuckPos + vec2f32_t(puckImages[imageIdx]) * cWrapDims,
+                    cPuckRadius, puckChannel );
+            }
+        }
+    }
+
+    { // Paddles //
+        uint8_t* const teamChannels[2] = {
+            &pOutput[channel::lpaddle * CHANNEL_BYTES], &pOutput[channel::rpaddle * CHANNEL_BYTES] };
+        for( uint32_t paddleIdx = 0; paddleIdx < pState->paddleCount; paddleIdx++ ) {
+            const ssn::paddle_t& cPaddle = pState->paddles[paddleIdx];
+            fill_circle( ssn::real::tof(cPaddle.pos()), ssn::real::tof(cPaddle.radius()),
+                teamChannels[paddleIdx % 2] );
+        }
+    }
+}
+
+}
+
+}
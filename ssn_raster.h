@@ -0,0 +1,35 @@
+#ifndef SSN_RASTER_H
+#define SSN_RASTER_H
+
+#include "ssn.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+namespace raster {
+
+/// Constants ///
+
+constexpr static uint32_t RESOLUTION = 64; // units: cells per axis
+constexpr static uint32_t CHANNEL_BYTES = RESOLUTION * RESOLUTION;
+
+LLCE_ENUM( channel, larea, rarea, puck, lpaddle, rpaddle, wall );
+
+constexpr static uint32_t OUTPUT_BYTES = channel::_length * CHANNEL_BYTES;
+
+/// Functions ///
+
+// NOTE(JRC): Renders the game board of the given state into 'pOutput', which
+// must hold 'OUTPUT_BYTES' bytes laid out as [channel][row][column] with row 0
+// at the bottom of the unit square (which contains every stage). A cell holds
+// 0xff if its center is covered by the channel's shapes and 0x00 otherwise;
+// as with scoring, later areas cover earlier ones, and all images of wrapping
+// pucks are drawn.
+void render( const ssn::state_t* pState, uint8_t* pOutput );
+
+}
+
+}
+
+#endif
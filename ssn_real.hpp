@@ -0,0 +1,100 @@
+#ifndef SSN_REAL_HPP
+#define SSN_REAL_HPP
+
+#include <cmath>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+#include "ssn_fixed_t.hpp"
+#include "consts.h"
+
+// NOTE(JRC): When enabled (see the 'SSN_FIXED_POINT' CMake option), all of the
+// simulation's kinematic state and kernels use 'ssn::fixed_t' instead of
+// 'float32_t', which makes simulation results reproducible across builds and
+// platforms (e.g. for lockstep netplay and replays). This trades speed for
+// determinism; compare 'ssn_bench' and 'ssn_bench_fixed' for the actual cost.
+#ifndef SSN_FIXED_POINT
+#define SSN_FIXED_POINT 0
+#endif
+
+namespace ssn {
+
+/// Types ///
+
+#if SSN_FIXED_POINT
+typedef ssn::fixed_t real_t;
+#else
+typedef float32_t real_t;
+#endif
+typedef glm::vec<2, real_t, glm::defaultp> vec2r_t;
+
+namespace real {
+
+/// Functions ///
+
+// NOTE(JRC): 'glm::dot', 'glm::length', etc. only accept IEEE floating-point
+// types, so all simulation kernels use the equivalent functions below instead.
+
+constexpr inline real_t tor( const float64_t pValue ) { return static_cast<real_t>( pValue ); }
+inline vec2r_t tor( const vec2f32_t& pValue ) { return vec2r_t( tor(pValue.x), tor(pValue.y) ); }
+constexpr inline float32_t tof( const real_t pValue ) { return static_cast<float32_t>( pValue ); }
+inline vec2f32_t tof( const vec2r_t& pValue ) { return vec2f32_t( tof(pValue.x), tof(pValue.y) ); }
+
+inline real_t infinity() {
+#if SSN_FIXED_POINT
+    return ssn::fixed_t::raw( std::numeric_limits<int32_t>::max() );
+#else
+    return std::numeric_limits<float32_t>::infinity();
+#endif
+}
+
+inline real_t epsilon() {
+#if SSN_FIXED_POINT
+    return ssn::fixed_t::raw( 1 );
+#else
+    return std::numeric_limits<float32_t>::epsilon();
+#endif
+}
+
+inline real_t sqrt( const real_t pValue ) {
+#if SSN_FIXED_POINT
+    return ssn::fixed_t::sqrt( pValue );
+#else
+    return std::sqrt( pValue );
+#endif
+}
+
+inline real_t floor( const real_t pValue ) {
+#if SSN_FIXED_POINT
+    return ssn::fixed_t::floor( pValue );
+#else
+    return std::floor( pValue );
+#endif
+}
+
+inline real_t min( const real_t pA, const real_t pB ) { return ( pB < pA ) ? pB : pA; }
+inline real_t max( const real_t pA, const real_t pB ) { return ( pA < pB ) ? pB : pA; }
+inline real_t clamp( const real_t pValue, const real_t pMin, const real_t pMax ) {
+    return real::min( real::max(pValue, pMin), pMax );
+}
+
+// Returns 'pValue' wrapped into the interval [pMin, pMin + pLength).
+inline real_t wrap( const real_t pValue, const real_t pMin, const real_t pLength ) {
+    const real_t cOffset = pValue - pMin;
+    return pMin + cOffset - pLength * real::floor( cOffset / pLength );
+}
+
+inline real_t dot( const vec2r_t& pA, const vec2r_t& pB ) { return pA.x * pB.x + pA.y * pB.y; }
+inline real_t length( const vec2r_t& pValue ) { return real::sqrt( real::dot(pValue, pValue) ); }
+inline vec2r_t normalize( const vec2r_t& pValue ) {
+    const real_t cLength = real::length( pValue );
+    return ( cLength > real_t(0) ) ?
+        vec2r_t( pValue.x / cLength, pValue.y / cLength ) : vec2r_t( real_t(0), real_t(0) );
+}
+
+}
+
+}
+
+#endif
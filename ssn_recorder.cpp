@@ -0,0 +1,153 @@
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "ssn_spsc_ring_t.hpp"
+#include "ssn_archive_t.h"
+#include "ssn_replay_t.h"
+#include "ssn_recorder.h"
+
+namespace ssn {
+
+namespace recorder {
+
+/// Constants ///
+
+constexpr static uint32_t RING_CAPACITY = 1 << 4; // units: finished rounds
+constexpr static std::chrono::milliseconds WRITER_PERIOD( 100 );
+
+/// Types ///
+
+struct job_t {
+    replay_t* mReplay;
+    float32_t mScoreTotals[2];
+};
+
+/// Global Variables ///
+
+static ssn::spsc_ring_t<job_t, RING_CAPACITY> sRing;
+static std::atomic<uint64_t> sDropped( 0 );
+static std::atomic<bool32_t> sActive( false );
+static std::atomic<bool32_t> sStopping( false );
+static std::thread sWriter;
+static std::string sPath;
+
+// NOTE(JRC): Only touched by the simulation thread.
+static replay_t* sReplay = nullptr;
+
+/// Helper Functions ///
+
+static void drain( archive_writer_t* pArchive ) {
+    job_t job;
+    while( sRing.pop(&job, 1) > 0 ) {
+        pArchive->append( job.mReplay, job.mScoreTotals );
+        delete job.mReplay;
+    }
+}
+
+
+static void write() {
+    // NOTE(JRC): Opening validates the whole existing archive, so it's done
+    // here rather than in 'start'; if it fails, finished rounds are discarded.
+    archive_writer_t archive;
+    archive.open( sPath.c_str() );
+
+    while( !sStopping.load(std::memory_order_acquire) ) {
+        drain( &archive );
+        std::this_thread::sleep_for( WRITER_PERIOD );
+    }
+    drain( &archive );
+
+    archive.close();
+}
+
+/// Functions ///
+
+bool32_t start( const char8_t* pPath ) {
+    if( sActive.load() ) {
+        stop();
+    }
+
+    sPath = pPath;
+    sDropped.store( 0 );
+    sStopping.store( false );
+    sWriter = std::thread( write );
+    sActive.store( true, std::memory_order_release );
+    return true;
+}
+
+
+uint64_t stop() {
+    cancel();
+    if( !sActive.load() ) {
+        return 0;
+    }
+
+    sActive.store( false, std::memory_order_release );
+    sStopping.store( true, std::memory_order_release );
+    sWriter.join();
+
+    const uint64_t cDropped = sDropped.load();
+    LLCE_CHECK_WARNING( cDropped == 0,
+        "Replay ring buffer overflowed; " << cDropped << " rounds weren't archived." );
+    return cDropped;
+}
+
+
+bool32_t active() {
+    return sActive.load( std::memory_order_relaxed );
+}
+
+
+void begin( const llce::rng_t& pRNG, const float64_t pDT,
+        const ssn::stage_e pStage, const ssn::format_e pFormat ) {
+    cancel();
+    if( active() ) {
+        sReplay = new replay_t( pRNG, pDT, pStage, pFormat );
+    }
+}
+
+
+void record( const ssn::actions_t& pActions ) {
+    if( sReplay != nullptr ) {
+        sReplay->record( pActions );
+    }
+}
+
+
+void end( const float32_t pScoreTotals[2] ) {
+    if( sReplay == nullptr ) {
+        return;
+    }
+
+    sReplay->flush();
+    const job_t cJob = { sReplay, { pScoreTotals[0], pScoreTotals[1] } };
+    if( !active() || !sRing.push(cJob) ) {
+        sDropped.fetch_add( 1, std::memory_order_relaxed );
+        delete sReplay;
+    }
+    sReplay = nullptr;
+}
+
+
+void cancel() {
+    delete sReplay;
+    sReplay = nullptr;
+}
+
+
+bool32_t recording() {
+    return sReplay != nullptr;
+}
+
+/// Global Guards ///
+
+// NOTE(JRC): A joinable 'std::thread' terminates the process when destroyed,
+// and static objects are destroyed when this module is unloaded (e.g. on hot
+// reloads and exit), so this guard joins the writer once the queue is drained.
+static struct guard_t { ~guard_t() { stop(); } } sGuard;
+
+}
+
+}
@@ -0,0 +1,37 @@
+#ifndef SSN_RECORDER_H
+#define SSN_RECORDER_H
+
+#include "rng_t.h"
+
+#include "ssn.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+namespace recorder {
+
+/// Functions ///
+
+// NOTE(JRC): Rounds are recorded on the simulation thread ('begin', 'record',
+// 'end' and 'cancel' only touch memory), and each round handed off by 'end' is
+// appended to the archive at the path given to 'start' (see 'ssn::archive_t')
+// by a background writer thread, so recording never blocks on file I/O.
+bool32_t start( const char8_t* pPath );
+uint64_t stop();
+bool32_t active();
+
+// NOTE(JRC): 'begin' discards any round still in progress, and 'pRNG' must be
+// the random state from before 'ssn::mode::game::init' (see 'ssn::replay_t').
+void begin( const llce::rng_t& pRNG, const float64_t pDT,
+    const ssn::stage_e pStage, const ssn::format_e pFormat );
+void record( const ssn::actions_t& pActions );
+void end( const float32_t pScoreTotals[2] );
+void cancel();
+bool32_t recording();
+
+}
+
+}
+
+#endif
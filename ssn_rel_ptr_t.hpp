@@ -0,0 +1,52 @@
+#ifndef SSN_REL_PTR_T_HPP
+#define SSN_REL_PTR_T_HPP
+
+#include "consts.h"
+
+namespace ssn {
+
+/// Class Declarations ///
+
+// NOTE(JRC): A pointer stored as a byte offset from its own address, so it's
+// only valid relative to the block of memory that contains both it and its
+// target. Copying that whole block (e.g. 'memcpy' of a whole 'ssn::state_t', a
+// shared memory mapping, or a restored snapshot) keeps it valid, but copying it
+// apart from its target (e.g. assigning a temporary entity into 'ssn::state_t')
+// leaves it dangling, so its owners must be constructed in place. Its copy
+// operations stay trivial so that 'ssn::state_t' remains trivially copyable.
+template <typename T>
+class rel_ptr_t {
+    public:
+
+    /// Constructors ///
+
+    rel_ptr_t() = default;
+
+    rel_ptr_t( const rel_ptr_t& ) = default;
+    rel_ptr_t& operator=( const rel_ptr_t& ) = default;
+
+    /// Class Functions ///
+
+    void set( const T* pTarget ) {
+        mOffset = ( pTarget == nullptr ) ? 0 : static_cast<int32_t>(
+            reinterpret_cast<const bit8_t*>(pTarget) - reinterpret_cast<const bit8_t*>(this) );
+    }
+
+    T* get() const {
+        return ( mOffset == 0 ) ? nullptr : reinterpret_cast<T*>(
+            const_cast<bit8_t*>(reinterpret_cast<const bit8_t*>(this)) + mOffset );
+    }
+
+    T* operator->() const { return get(); }
+    T& operator*() const { return *get(); }
+
+    /// Class Fields ///
+
+    public:
+
+    int32_t mOffset; // units: bytes from this pointer to the target; 0 if null
+};
+
+}
+
+#endif
@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "ssn_modes.h"
+#include "ssn_replay_t.h"
+
+namespace ssn {
+
+/// Helper Functions ///
+
+static void varint_write( std::vector<bit8_t>* pStream, uint64_t pValue ) {
+    for( ; pValue >= 0x80; pValue >>= 7 ) {
+        pStream->push_back( static_cast<bit8_t>((pValue & 0x7f) | 0x80) );
+    }
+    pStream->push_back( static_cast<bit8_t>(pValue) );
+}
+
+
+// NOTE(JRC): Readers fail instead of reading past 'pBytes' so that a truncated
+// or corrupt stream (e.g. a torn archive entry) can't run off of its buffer.
+static bool32_t varint_read( const bit8_t* pStream, const uint64_t pBytes, uint64_t* pOffset, uint64_t* pValue ) {
+    *pValue = 0;
+    for( uint32_t shift = 0; shift < 64 && *pOffset < pBytes; shift += 7 ) {
+        const bit8_t cByte = pStream[(*pOffset)++];
+        *pValue |= static_cast<uint64_t>( cByte & 0x7f ) << shift;
+        if( !(cByte & 0x80) ) { return true; }
+    }
+    return false;
+}
+
+
+static bool32_t run_read( const bit8_t* pStream, const uint64_t pBytes, uint64_t* pOffset,
+        uint64_t* pRunLength, ssn::actions_t* pActions ) {
+    uint64_t down = 0, pressed = 0;
+    const bool32_t cRead = varint_read( pStream, pBytes, pOffset, pRunLength ) &&
+        varint_read( pStream, pBytes, pOffset, &down ) &&
+        varint_read( pStream, pBytes, pOffset, &pressed );
+    pActions->down = static_cast<uint16_t>( down );
+    pActions->pressed = static_cast<uint16_t>( pressed );
+    return cRead && *pRunLength > 0 && down <= UINT16_MAX && pressed <= UINT16_MAX;
+}
+
+/// 'ssn::replay_t' Functions ///
+
+replay_t::replay_t( const llce::rng_t& pRNG, const float64_t pDT,
+            const ssn::stage_e pStage, const ssn::format_e pFormat ) :
+        mRunActions{ 0, 0 }, mRunLength( 0 ) {
+    std::memset( &mHeader, 0, sizeof(mHeader) );
+    mHeader.mMagic = replay_t::MAGIC;
+    mHeader.mVersion = replay_t::VERSION;
+    mHeader.mRNG = pRNG;
+    mHeader.mDT = pDT;
+    mHeader.mStage = pStage;
+    mHeader.mFormat = pFormat;
+    mHeader.mStateBytes = sizeof(ssn::state_t);
+}
+
+
+void replay_t::start( ssn::state_t* pState ) const {
+    pState->mode = pState->pmode = ssn::mode::game::ID;
+    pState->rng = mHeader.mRNG;
+    pState->sid = mHeader.mStage;
+    pState->fid = mHeader.mFormat;
+    pState->dt = mHeader.mDT;
+    pState->tt = pState->st = 0.0;
+    // NOTE(JRC): 'ssn::mode::game::init' doesn't read any input.
+    ssn::mode::game::init( pState, nullptr );
+}
+
+
+void replay_t::record( const ssn::actions_t& pActions ) {
+    if( pActions.down != mRunActions.down || pActions.pressed != mRunActions.pressed ) {
+        flush();
+    }
+
+    mRunActions = pActions;
+    mRunLength++;
+    mHeader.mTickCount++;
+}
+
+
+void replay_t::flush() {
+    if( mRunLength > 0 ) {
+        varint_write( &mStream, mRunLength );
+        varint_write( &mStream, mRunActions.down );
+        varint_write( &mStream, mRunActions.pressed );
+        mRunLength = 0;
+    }
+    mHeader.mStreamBytes = mStream.size();
+}
+
+
+bool32_t replay_t::save( const char8_t* pPath ) {
+    flush();
+
+    std::FILE* file = std::fopen( pPath, "wb" );
+    LLCE_CHECK_WARNING( file != nullptr,
+        "Couldn't save replay; failed to open file '" << pPath << "' for writing." );
+    if( file == nullptr ) {
+        return false;
+    }
+
+    bool32_t saved =
+        std::fwrite( &mHeader, sizeof(mHeader), 1, file ) == 1 &&
+        std::fwrite( mStream.data(), 1, mStream.size(), file ) == mStream.size();
+    saved = ( std::fclose(file) == 0 ) && saved;
+    return saved;
+}
+
+
+bool32_t replay_t::load( const char8_t* pPath, replay_t* pReplay ) {
+    std::FILE* file = std::fopen( pPath, "rb" );
+    LLCE_CHECK_WARNING( file != nullptr,
+        "Couldn't load replay; failed to open file '" << pPath << "' for reading." );
+    if( file == nullptr ) {
+        return false;
+    }
+
+    bool32_t loaded = std::fread( &pReplay->mHeader, sizeof(pReplay->mHeader), 1, file ) == 1 &&
+        pReplay->mHeader.mMagic == replay_t::MAGIC && pReplay->mHeader.mVersion == replay_t::VERSION;
+    if( loaded ) {
+        pReplay->mStream.resize( pReplay->mHeader.mStreamBytes );
+        loaded = std::fread( pReplay->mStream.data(), 1, pReplay->mStream.size(), file ) ==
+            pReplay->mStream.size();
+    }
+    pReplay->mRunActions = { 0, 0 };
+    pReplay->mRunLength = 0;
+    std::fclose( file );
+
+    LLCE_CHECK_WARNING( loaded,
+        "Couldn't load replay; file '" << pPath << "' is truncated or isn't a " <<
+        "version " << replay_t::VERSION << " replay." );
+    if( !loaded ) {
+        return false;
+    }
+
+    // NOTE(JRC): A different state size means a different build, which isn't
+    // guaranteed to re-simulate the recorded actions identically.
+    const bool32_t cIsCompatible = pReplay->mHeader.mStateBytes == sizeof(ssn::state_t);
+    LLCE_CHECK_WARNING( cIsCompatible,
+        "Couldn't load replay; file '" << pPath << "' was recorded with a " <<
+        pReplay->mHeader.mStateBytes << " byte state, but this build's state is " <<
+        sizeof(ssn::state_t) << " bytes." );
+    return cIsCompatible;
+}
+
+/// 'ssn::replay_player_t' Functions ///
+
+replay_player_t::replay_player_t( const replay_t::header_t& pHeader, const bit8_t* pStream,
+            ssn::state_t* pState ) :
+        mHeader( pHeader ), mStream( pStream ), mState( pState ),
+        mTick( 0 ), mOffset( 0 ), mRunActions{ 0, 0 }, mRunRemaining( 0 ) {
+    replay_t( mHeader.mRNG, mHeader.mDT, mHeader.mStage, mHeader.mFormat ).start( mState );
+    cache();
+}
+
+
+replay_player_t::replay_player_t( const replay_t* pReplay, ssn::state_t* pState ) :
+        replay_player_t( pReplay->mHeader, pReplay->mStream.data(), pState ) {
+
+}
+
+
+bool32_t replay_player_t::step() {
+    if( done() ) {
+        return false;
+    }
+
+    if( mRunRemaining == 0 ) {
+        const bool32_t cRead = run_read( mStream, mHeader.mStreamBytes, &mOffset, &mRunRemaining, &mRunActions );
+        LLCE_CHECK_WARNING( cRead,
+            "Couldn't step replay at tick " << mTick << "; its action stream is " <<
+            "truncated or corrupt at byte " << mOffset << "." );
+        if( !cRead ) {
+            mRunRemaining = 0;
+            return false;
+        }
+    }
+    mRunRemaining--;
+
+    ssn::mode::game::step( mState, mRunActions, mHeader.mDT );
+    mState->tt += mHeader.mDT;
+    mState->st += mHeader.mDT;
+    mTick++;
+    cache();
+
+    return true;
+}
+
+
+bool32_t replay_player_t::seek( const uint64_t pTick ) {
+    LLCE_CHECK_WARNING( pTick <= mHeader.mTickCount,
+        "Couldn't seek replay to tick " << pTick << "; " <<
+        "replay only has " << mHeader.mTickCount << " ticks." );
+    if( pTick > mHeader.mTickCount ) {
+        return false;
+    }
+
+    // NOTE(JRC): Playback resumes from the nearest cached keyframe at or before
+    // the target tick, unless the current tick is already closer. Keyframes are
+    // only cached for ticks that have been played, so the first seek past them
+    // re-simulates (and caches) the intervening ticks.
+    const uint64_t cSeekIdx = std::min<uint64_t>(
+        pTick / replay_t::KEYFRAME_INTERVAL, mKeyframes.size() / KEYFRAME_BYTES - 1 );
+    const uint64_t cSeekTick = cSeekIdx * replay_t::KEYFRAME_INTERVAL;
+
+    if( mTick > pTick || mTick < cSeekTick ) {
+        keyframe_t keyframe;
+        const bit8_t* cKeyframeBytes = &mKeyframes[cSeekIdx * KEYFRAME_BYTES];
+        std::memcpy( &keyframe, cKeyframeBytes, sizeof(keyframe_t) );
+        std::memcpy( mState, cKeyframeBytes + sizeof(keyframe_t), sizeof(ssn::state_t) );
+
+        mTick = cSeekTick;
+        mOffset = keyframe.mOffset;
+        mRunActions = keyframe.mRunActions;
+        mRunRemaining = keyframe.mRunRemaining;
+    }
+
+    while( mTick < pTick ) {
+        if( !step() ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Helper Functions ///
+
+void replay_player_t::cache() {
+    if( mTick % replay_t::KEYFRAME_INTERVAL == 0 &&
+            mTick / replay_t::KEYFRAME_INTERVAL == mKeyframes.size() / KEYFRAME_BYTES ) {
+        const keyframe_t cKeyframe = { mOffset, mRunRemaining, mRunActions };
+        const bit8_t* cKeyframeBytes = reinterpret_cast<const bit8_t*>( &cKeyframe );
+        const bit8_t* cStateBytes = reinterpret_cast<const bit8_t*>( mState );
+        mKeyframes.insert( mKeyframes.end(), cKeyframeBytes, cKeyframeBytes + sizeof(keyframe_t) );
+        mKeyframes.insert( mKeyframes.end(), cStateBytes, cStateBytes + sizeof(ssn::state_t) );
+    }
+}
+
+}
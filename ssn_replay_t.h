@@ -0,0 +1,127 @@
+#ifndef SSN_REPLAY_T_H
+#define SSN_REPLAY_T_H
+
+#include <vector>
+
+#include "rng_t.h"
+
+#include "ssn.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+// NOTE(JRC): A replay is the seed and settings of a round plus its per-tick
+// 'ssn::actions_t', stored as a stream of runs where each run is encoded as
+// (varint length, varint down bits, varint pressed bits). Rounds are recreated
+// by re-simulating these actions, which relies on the simulation being
+// deterministic for a given build (see 'SSN_FIXED_POINT' for cross-build use).
+// Seek points aren't stored since a full 'ssn::state_t' per point would dwarf
+// the stream; players instead cache a keyframe every 'KEYFRAME_INTERVAL' ticks
+// as they go (see 'ssn::replay_player_t::seek').
+class replay_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t MAGIC = 0x524e5353; // units: 'SSNR' (little endian)
+    constexpr static uint32_t VERSION = 3;
+    constexpr static uint32_t KEYFRAME_INTERVAL = 512; // units: ticks between seek points
+
+    /// Class Types ///
+
+    struct header_t {
+        uint32_t mMagic;
+        uint32_t mVersion;
+        llce::rng_t mRNG;    // state random number generator at round start
+        float64_t mDT;       // units: seconds per tick
+        stage_e mStage;
+        format_e mFormat;
+        uint64_t mTickCount;
+        uint64_t mStreamBytes;
+        uint64_t mStateBytes;  // units: bytes of the recording build's 'ssn::state_t'
+    };
+
+    /// Constructors ///
+
+    replay_t( const llce::rng_t& pRNG, const float64_t pDT,
+        const ssn::stage_e pStage, const ssn::format_e pFormat );
+
+    /// Class Functions ///
+
+    void start( ssn::state_t* pState ) const;
+    void record( const ssn::actions_t& pActions );
+    void flush();
+
+    bool32_t save( const char8_t* pPath );
+    static bool32_t load( const char8_t* pPath, replay_t* pReplay );
+
+    /// Class Fields ///
+
+    public:
+
+    header_t mHeader;
+    std::vector<bit8_t> mStream;
+
+    private:
+
+    ssn::actions_t mRunActions;
+    uint64_t mRunLength;
+};
+
+
+class replay_player_t {
+    public:
+
+    /// Constructors ///
+
+    // NOTE(JRC): The stream isn't copied, so it can be read directly from an
+    // external buffer (e.g. a memory-mapped archive); it must outlive the player.
+    replay_player_t( const replay_t::header_t& pHeader, const bit8_t* pStream, ssn::state_t* pState );
+    replay_player_t( const replay_t* pReplay, ssn::state_t* pState );
+
+    /// Class Functions ///
+
+    bool32_t step();
+    bool32_t seek( const uint64_t pTick );
+
+    uint64_t tick() const { return mTick; }
+    bool32_t done() const { return mTick >= mHeader.mTickCount; }
+
+    /// Helper Functions ///
+
+    private:
+
+    void cache();
+
+    /// Class Types ///
+
+    private:
+
+    struct keyframe_t {
+        uint64_t mOffset;
+        uint64_t mRunRemaining;
+        ssn::actions_t mRunActions;
+    };
+
+    constexpr static uint64_t KEYFRAME_BYTES = sizeof(keyframe_t) + sizeof(ssn::state_t);
+
+    /// Class Fields ///
+
+    private:
+
+    replay_t::header_t mHeader;
+    const bit8_t* mStream;
+    ssn::state_t* mState;
+
+    uint64_t mTick;
+    uint64_t mOffset; // units: bytes into the stream of the next run
+    ssn::actions_t mRunActions;
+    uint64_t mRunRemaining;
+
+    std::vector<bit8_t> mKeyframes; // units: 'keyframe_t' then 'ssn::state_t' per interval played
+};
+
+}
+
+#endif
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "ssn_modes.h"
+#include "ssn_rollback_t.h"
+
+namespace ssn {
+
+/// Helper Functions ///
+
+static uint16_t team_mask( const ssn::team_e pTeam ) {
+    const static uint32_t csTeamActions[2][5] = {
+        { ssn::action::lup, ssn::action::ldown, ssn::action::lleft, ssn::action::lright, ssn::action::lrush },
+        { ssn::action::rup, ssn::action::rdown, ssn::action::rleft, ssn::action::rright, ssn::action::rrush } };
+
+    uint16_t teamMask = 0;
+    for( uint32_t actionIdx = 0; actionIdx < LLCE_ELEM_COUNT(csTeamActions[pTeam]); actionIdx++ ) {
+        teamMask |= static_cast<uint16_t>( 1 << csTeamActions[pTeam][actionIdx] );
+    }
+    return teamMask;
+}
+
+/// Class Functions ///
+
+rollback_t::rollback_t( ssn::state_t* pState, ssn::transport_t* pTransport,
+        const ssn::team_e pLocalTeam, const float64_t pDT ) :
+        mState( pState ), mTransport( pTransport ), mDT( pDT ),
+        mTick( 0 ), mRemoteTick( 0 ), mPeerAck( 0 ) {
+    mLocalMask = team_mask( pLocalTeam );
+    mRemoteMask = team_mask( (pLocalTeam == ssn::team::left) ? ssn::team::right : ssn::team::left );
+
+    std::memset( &mStats, 0, sizeof(mStats) );
+    std::memset( &mLocalInputs[0], 0, sizeof(mLocalInputs) );
+    std::memset( &mRemoteInputs[0], 0, sizeof(mRemoteInputs) );
+}
+
+
+bool32_t rollback_t::advance( const ssn::actions_t& pLocalActions ) {
+    mStats.mDepth = 0;
+    mStats.mResimTime = 0.0;
+
+    const uint32_t cRollbackTick = receive();
+    if( cRollbackTick < mTick ) {
+        resimulate( cRollbackTick );
+    }
+
+    if( mTick >= mRemoteTick + rollback_t::WINDOW ) {
+        mStats.mStallCount++;
+        send();
+        return false;
+    }
+
+    ssn::actions_t& localInput = mLocalInputs[mTick % rollback_t::INPUT_COUNT];
+    localInput.down = pLocalActions.down & mLocalMask;
+    localInput.pressed = pLocalActions.pressed & mLocalMask;
+
+    mSnapshots.capture( mState );
+    simulate( mTick++ );
+    send();
+
+    return true;
+}
+
+
+bool32_t rollback_t::flush() {
+    mStats.mDepth = 0;
+    mStats.mResimTime = 0.0;
+
+    const uint32_t cRollbackTick = receive();
+    if( cRollbackTick < mTick ) {
+        resimulate( cRollbackTick );
+    }
+    send();
+
+    return mRemoteTick >= mTick;
+}
+
+
+uint32_t rollback_t::tick() const {
+    return mTick;
+}
+
+
+uint32_t rollback_t::confirmed() const {
+    return std::min( mTick, mRemoteTick );
+}
+
+/// Helper Functions ///
+
+void rollback_t::send() {
+    // NOTE(JRC): The peer can never fall more than 'INPUT_COUNT' ticks behind
+    // (each side stalls a 'WINDOW' ahead of the other), so the clamp here is
+    // purely defensive against a misbehaving peer.
+    const uint32_t cHistoryStart = ( mTick > rollback_t::INPUT_COUNT ) ? mTick - rollback_t::INPUT_COUNT : 0;
+    const uint32_t cFirstTick = std::max( mPeerAck, cHistoryStart );
+
+    packet_t packet;
+    std::memset( &packet, 0, sizeof(packet) );
+    packet.mMagic = rollback_t::MAGIC;
+    packet.mFirstTick = cFirstTick;
+    packet.mAckTick = mRemoteTick;
+    packet.mCount = std::min( mTick - cFirstTick, rollback_t::PACKET_INPUT_COUNT );
+    for( uint32_t inputIdx = 0; inputIdx < packet.mCount; inputIdx++ ) {
+        packet.mInputs[inputIdx] = mLocalInputs[( cFirstTick + inputIdx ) % rollback_t::INPUT_COUNT];
+    }
+
+    mTransport->send( reinterpret_cast<const bit8_t*>(&packet), sizeof(packet) );
+}
+
+
+uint32_t rollback_t::receive() {
+    uint32_t rollbackTick = mTick;
+
+    packet_t packet;
+    for( uint32_t packetBytes = mTransport->recv( reinterpret_cast<bit8_t*>(&packet), sizeof(packet) );
+            packetBytes != 0;
+            packetBytes = mTransport->recv(reinterpret_cast<bit8_t*>(&packet), sizeof(packet)) ) {
+        if( packetBytes != sizeof(packet) || packet.mMagic != rollback_t::MAGIC ||
+                packet.mCount > rollback_t::PACKET_INPUT_COUNT ) {
+            continue;
+        }
+
+        mPeerAck = std::max( mPeerAck, std::min(packet.mAckTick, mTick) );
+
+        // NOTE(JRC): Remote inputs are only accepted in tick order; anything
+        // past a gap is dropped and will be resent starting from our ack.
+        for( uint32_t inputIdx = 0; inputIdx < packet.mCount; inputIdx++ ) {
+            const uint32_t cInputTick = packet.mFirstTick + inputIdx;
+            if( cInputTick < mRemoteTick ) { continue; }
+            if( cInputTick > mRemoteTick || cInputTick >= mTick + rollback_t::WINDOW ) { break; }
+
+            ssn::actions_t remoteInput = packet.mInputs[inputIdx];
+            remoteInput.down &= mRemoteMask;
+            remoteInput.pressed &= mRemoteMask;
+
+            ssn::actions_t& storedInput = mRemoteInputs[cInputTick % rollback_t::INPUT_COUNT];
+            if( cInputTick < mTick && (storedInput.down != remoteInput.down ||
+                    storedInput.pressed != remoteInput.pressed) ) {
+                rollbackTick = std::min( rollbackTick, cInputTick );
+            }
+            storedInput = remoteInput;
+            mRemoteTick++;
+        }
+    }
+
+    return rollbackTick;
+}
+
+
+void rollback_t::resimulate( const uint32_t pFromTick ) {
+    const auto cStartTime = std::chrono::steady_clock::now();
+
+    // NOTE(JRC): A snapshot is captured before every simulated tick, so the
+    // state before tick 't' is '(mTick - 1) - t' frames ago.
+    const bool32_t cRewound = mSnapshots.rewind( (mTick - 1) - pFromTick, mState );
+    LLCE_CHECK_WARNING( cRewound,
+        "Couldn't roll back to tick " << pFromTick << "; the snapshot history " <<
+        "doesn't reach back " << mTick - pFromTick << " ticks." );
+    if( !cRewound ) {
+        return;
+    }
+
+    for( uint32_t tickIdx = pFromTick; tickIdx < mTick; tickIdx++ ) {
+        if( tickIdx != pFromTick ) {
+            mSnapshots.capture( mState );
+        }
+        simulate( tickIdx );
+    }
+
+    const float64_t cResimTime = std::chrono::duration<float64_t>(
+        std::chrono::steady_clock::now() - cStartTime ).count();
+    mStats.mDepth = mTick - pFromTick;
+    mStats.mMaxDepth = std::max( mStats.mMaxDepth, mStats.mDepth );
+    mStats.mResimTime = cResimTime;
+    mStats.mMaxResimTime = std::max( mStats.mMaxResimTime, cResimTime );
+    mStats.mRollbackCount++;
+    mStats.mResimTicks += mStats.mDepth;
+}
+
+
+void rollback_t::simulate( const uint32_t pTick ) {
+    // NOTE(JRC): Unconfirmed remote inputs are predicted by holding the last
+    // confirmed directions; presses are never predicted since a mispredicted
+    // rush is far more jarring to undo than a late one.
+    ssn::actions_t& remoteInput = mRemoteInputs[pTick % rollback_t::INPUT_COUNT];
+    if( pTick >= mRemoteTick ) {
+        remoteInput.down = ( mRemoteTick == 0 ) ? 0 :
+            mRemoteInputs[( mRemoteTick - 1 ) % rollback_t::INPUT_COUNT].down;
+        remoteInput.pressed = 0;
+    }
+
+    const ssn::actions_t& cLocalInput = mLocalInputs[pTick % rollback_t::INPUT_COUNT];
+    const ssn::actions_t cActions = {
+        static_cast<uint16_t>( cLocalInput.down | remoteInput.down ),
+        static_cast<uint16_t>( cLocalInput.pressed | remoteInput.pressed ) };
+
+    ssn::mode::game::step( mState, cActions, mDT );
+    mState->tt += mDT;
+    mState->st += mDT;
+}
+
+}
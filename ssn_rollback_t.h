@@ -0,0 +1,111 @@
+#ifndef SSN_ROLLBACK_T_H
+#define SSN_ROLLBACK_T_H
+
+#include "ssn.h"
+#include "ssn_snapshot_ring_t.h"
+#include "ssn_transport_t.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+// NOTE(JRC): Drives a 'ssn::mode::game' round shared between a local player
+// and a remote player (one team each) connected by a 'transport_t'. The remote
+// player's actions are predicted (held directions persist, presses don't) so
+// that local input is applied immediately; every simulated tick is captured
+// in a 'snapshot_ring_t', and when a remote action arrives that doesn't match
+// its prediction, the state is rewound to that tick and all of the ticks since
+// are re-simulated within the same call to 'advance'.
+class rollback_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t MAGIC = 0x4e4e5353; // units: 'SSNN' (little endian)
+    constexpr static uint32_t WINDOW = 32;        // units: maximum ticks of prediction
+    constexpr static uint32_t INPUT_COUNT = 2 * WINDOW; // units: ticks of input history
+    constexpr static uint32_t PACKET_INPUT_COUNT = 16;  // units: ticks of input per packet
+
+    static_assert( WINDOW < snapshot_ring_t::FRAME_COUNT,
+        "Insufficient snapshot history for rollback; please keep 'ssn::rollback_t::WINDOW' "
+        "below 'ssn::snapshot_ring_t::FRAME_COUNT'." );
+
+    /// Class Types ///
+
+    // NOTE(JRC): Each packet carries the sender's actions for a run of ticks
+    // starting at the first tick the receiver hasn't acknowledged, so lost
+    // packets are recovered by the next packet that arrives.
+    struct packet_t {
+        uint32_t mMagic;
+        uint32_t mFirstTick; // units: tick of 'mInputs[0]'
+        uint32_t mAckTick;   // units: count of contiguous ticks received from the peer
+        uint32_t mCount;     // units: entries used in 'mInputs'
+        ssn::actions_t mInputs[PACKET_INPUT_COUNT];
+    };
+
+    struct stats_t {
+        uint32_t mDepth;        // units: ticks rolled back by the last 'advance'
+        uint32_t mMaxDepth;     // units: ticks
+        float64_t mResimTime;   // units: seconds spent re-simulating in the last 'advance'
+        float64_t mMaxResimTime; // units: seconds
+        uint64_t mRollbackCount;
+        uint64_t mResimTicks;   // units: ticks re-simulated in total
+        uint64_t mStallCount;   // units: calls to 'advance' that waited on the peer
+    };
+
+    /// Constructors ///
+
+    rollback_t( ssn::state_t* pState, ssn::transport_t* pTransport,
+        const ssn::team_e pLocalTeam, const float64_t pDT );
+
+    rollback_t( const rollback_t& ) = delete;
+    rollback_t& operator=( const rollback_t& ) = delete;
+
+    /// Class Functions ///
+
+    // NOTE(JRC): Returns false (without simulating) if the local player is a
+    // full 'WINDOW' of ticks ahead of the last confirmed remote tick; the
+    // caller should keep calling 'advance' until the peer catches up.
+    bool32_t advance( const ssn::actions_t& pLocalActions );
+    // NOTE(JRC): Receives (and rolls back for) pending remote input and resends
+    // local input without simulating a tick; returns true once the remote input
+    // for every simulated tick has arrived (e.g. to settle the end of a round).
+    bool32_t flush();
+
+    uint32_t tick() const;
+    uint32_t confirmed() const;
+
+    /// Helper Functions ///
+
+    private:
+
+    void send();
+    uint32_t receive();
+    void resimulate( const uint32_t pFromTick );
+    void simulate( const uint32_t pTick );
+
+    /// Class Fields ///
+
+    public:
+
+    stats_t mStats;
+
+    private:
+
+    ssn::state_t* mState;
+    ssn::transport_t* mTransport;
+    ssn::snapshot_ring_t mSnapshots;
+    float64_t mDT; // units: seconds per tick
+
+    uint16_t mLocalMask, mRemoteMask; // units: 'ssn::actions_t' bits per player
+    ssn::actions_t mLocalInputs[INPUT_COUNT];  // units: indexed by tick % INPUT_COUNT
+    ssn::actions_t mRemoteInputs[INPUT_COUNT]; // units: indexed by tick % INPUT_COUNT
+
+    uint32_t mTick;       // units: ticks simulated
+    uint32_t mRemoteTick; // units: contiguous ticks of remote input received
+    uint32_t mPeerAck;    // units: contiguous ticks of local input received by the peer
+};
+
+}
+
+#endif
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "ssn_modes.h"
+#include "ssn_bot_t.h"
+#include "ssn_runner_t.h"
+
+namespace ssn {
+
+/// Class Functions ///
+
+runner_t::runner_t( const uint32_t pMatchCount, const uint32_t pThreadCount, const uint64_t pSeed ) :
+        mMatchCount( pMatchCount ), mDT( 0.0 ), mStage( ssn::stage::box ), mFormat( ssn::format::duel ), mPolicy( nullptr ),
+        mPoolGeneration( 0 ), mPoolActiveCount( 0 ), mPoolExiting( false ) {
+    // NOTE(JRC): 'ssn::state_t' isn't default constructible (it's normally
+    // allocated as a raw block by the harness), so the matches are allocated
+    // the same way and then initialized in-place.
+    mMatches = static_cast<match_t*>( std::aligned_alloc(
+        alignof(match_t), pMatchCount * sizeof(match_t)) );
+    std::memset( static_cast<void*>(mMatches), 0, pMatchCount * sizeof(match_t) );
+    for( uint32_t matchIdx = 0; matchIdx < mMatchCount; matchIdx++ ) {
+        match_t& match = mMatches[matchIdx];
+        match.state.rng = llce::rng_t( pSeed + 2 * matchIdx + 0 );
+        match.rng = llce::rng_t( pSeed + 2 * matchIdx + 1 );
+    }
+
+    mWorkerCount = ( pThreadCount != 0 ) ? pThreadCount :
+        std::max( std::thread::hardware_concurrency(), 1u );
+    mQueues = new queue_t[mWorkerCount];
+    for( uint32_t workerIdx = 0; workerIdx < mWorkerCount; workerIdx++ ) {
+        mQueues[workerIdx].next.store( 0 );
+        mQueues[workerIdx].end = 0;
+    }
+
+    mWorkers.reserve( mWorkerCount );
+    for( uint32_t workerIdx = 0; workerIdx < mWorkerCount; workerIdx++ ) {
+        mWorkers.emplace_back( &runner_t::work, this, workerIdx );
+    }
+}
+
+
+runner_t::~runner_t() {
+    {
+        std::lock_guard<std::mutex> poolLock( mPoolMutex );
+        mPoolExiting = true;
+    }
+    mPoolStartCV.notify_all();
+    for( std::thread& worker : mWorkers ) {
+        worker.join();
+    }
+
+    delete[] mQueues;
+    std::free( mMatches );
+}
+
+
+runner_t::result_t runner_t::run( const uint64_t pRoundCount, const float64_t pDT,
+        const ssn::stage_e pStage, const ssn::format_e pFormat, const policy_f pPolicy ) {
+    mDT = pDT;
+    mStage = pStage;
+    mFormat = pFormat;
+    mPolicy = ( pPolicy != nullptr ) ? pPolicy : runner_t::policyRandom;
+
+    for( uint32_t matchIdx = 0; matchIdx < mMatchCount; matchIdx++ ) {
+        match_t& match = mMatches[matchIdx];
+        match.rounds = pRoundCount / mMatchCount + ( matchIdx < pRoundCount % mMatchCount );
+        std::memset( &match.result, 0, sizeof(match.result) );
+        match.heatmap.clear();
+    }
+
+    // NOTE(JRC): Each worker starts with a contiguous range of matches; once
+    // its own range is exhausted, it steals matches from the ranges of other
+    // workers. Every match is claimed by exactly one atomic increment, so each
+    // match (and its result slot) is only ever touched by a single thread.
+    for( uint32_t workerIdx = 0; workerIdx < mWorkerCount; workerIdx++ ) {
+        queue_t& queue = mQueues[workerIdx];
+        queue.next.store( static_cast<uint32_t>((mMatchCount * (workerIdx + 0ull)) / mWorkerCount) );
+        queue.end = static_cast<uint32_t>( (mMatchCount * (workerIdx + 1ull)) / mWorkerCount );
+    }
+
+    { // Dispatch Workers //
+        std::unique_lock<std::mutex> poolLock( mPoolMutex );
+        mPoolActiveCount = mWorkerCount;
+        mPoolGeneration++;
+        mPoolStartCV.notify_all();
+        mPoolDoneCV.wait( poolLock, [this] { return mPoolActiveCount == 0; } );
+    }
+
+    result_t total;
+    std::memset( &total, 0, sizeof(total) );
+    for( uint32_t matchIdx = 0; matchIdx < mMatchCount; matchIdx++ ) {
+        const result_t& result = mMatches[matchIdx].result;
+        total.rounds += result.rounds;
+        total.ticks += result.ticks;
+        for( uint32_t team = 0; team < ssn::team::_length; team++ ) {
+            total.areas[team] += result.areas[team];
+            total.wins[team] += result.wins[team];
+        }
+    }
+
+    return total;
+}
+
+
+void runner_t::heatmap( ssn::heatmap_t* pHeatmap ) const {
+    pHeatmap->clear();
+    for( uint32_t matchIdx = 0; matchIdx < mMatchCount; matchIdx++ ) {
+        pHeatmap->merge( mMatches[matchIdx].heatmap );
+    }
+}
+
+
+void runner_t::policyRandom( const ssn::state_t* pState, llce::rng_t* pRNG, ssn::actions_t* pActions ) {
+    const static float32_t csTurnChance = 5.0e-2f, csRushChance = 1.0e-2f;
+    const static uint32_t csTeamActions[2][5] = {
+        { ssn::action::lup, ssn::action::ldown, ssn::action::lleft, ssn::action::lright, ssn::action::lrush },
+        { ssn::action::rup, ssn::action::rdown, ssn::action::rleft, ssn::action::rright, ssn::action::rrush } };
+
+    // NOTE(JRC): Held directions are carried between ticks so that the
+    // paddles wander in runs rather than jittering in place.
+    pActions->pressed = 0;
+    for( uint8_t team = ssn::team::left; team <= ssn::team::right; team++ ) {
+        const uint32_t* teamActions = &csTeamActions[team][0];
+        for( uint32_t dirIdx = 0; dirIdx < 4; dirIdx++ ) {
+            if( pRNG->nextf() < csTurnChance ) {
+                pActions->down ^= static_cast<uint16_t>( 1 << teamActions[dirIdx] );
+            }
+        } if( pRNG->nextf() < csRushChance ) {
+            pActions->pressed |= static_cast<uint16_t>( 1 << teamActions[4] );
+        }
+    }
+}
+
+
+void runner_t::policyBot( const ssn::state_t* pState, llce::rng_t* pRNG, ssn::actions_t* pActions ) {
+    // NOTE(JRC): Bots only carry statistics between ticks, so new ones are
+    // made for each call, which keeps this function safe to call from all of
+    // the workers at once. Their budgets count work rather than time, so match
+    // results don't depend on worker count or machine load.
+    ssn::bot_t leftBot( ssn::team::left ), rightBot( ssn::team::right );
+    const ssn::actions_t cLeftActions = leftBot.act( pState );
+    const ssn::actions_t cRightActions = rightBot.act( pState );
+    pActions->down = cLeftActions.down | cRightActions.down;
+    pActions->pressed = cLeftActions.pressed | cRightActions.pressed;
+}
+
+/// Helper Functions ///
+
+void runner_t::work( const uint32_t pWorkerIdx ) {
+    uint64_t workerGeneration = 0;
+
+    while( true ) {
+        {
+            std::unique_lock<std::mutex> poolLock( mPoolMutex );
+            mPoolStartCV.wait( poolLock, [this, workerGeneration]
+                { return mPoolExiting || mPoolGeneration != workerGeneration; } );
+            if( mPoolExiting ) { return; }
+            workerGeneration = mPoolGeneration;
+        }
+
+        for( uint32_t queueOffset = 0; queueOffset < mWorkerCount; queueOffset++ ) {
+            queue_t& queue = mQueues[( pWorkerIdx + queueOffset ) % mWorkerCount];
+            for( uint32_t matchIdx = queue.next.fetch_add( 1, std::memory_order_relaxed );
+                    matchIdx < queue.end;
+                    matchIdx = queue.next.fetch_add( 1, std::memory_order_relaxed ) ) {
+                play( &mMatches[matchIdx] );
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> poolLock( mPoolMutex );
+            if( --mPoolActiveCount == 0 ) {
+                mPoolDoneCV.notify_one();
+            }
+        }
+    }
+}
+
+
+void runner_t::play( match_t* pMatch ) {
+    ssn::state_t* const state = &pMatch->state;
+    result_t* const result = &pMatch->result;
+
+    for( uint64_t roundIdx = 0; roundIdx < pMatch->rounds; roundIdx++ ) {
+        state->mode = state->pmode = ssn::mode::game::ID;
+        state->sid = mStage;
+        state->fid = mFormat;
+        state->dt = mDT;
+        state->st = 0.0;
+        ssn::mode::game::init( state, &pMatch->input );
+
+        ssn::actions_t actions = { 0, 0 };
+        while( state->pmode == ssn::mode::game::ID ) {
+            mPolicy( state, &pMatch->rng, &actions );
+            ssn::mode::game::step( state, actions, mDT, &pMatch->heatmap );
+            pMatch->heatmap.sample( state );
+            state->tt += mDT;
+            state->st += mDT;
+            result->ticks++;
+        }
+
+        const ssn::bounds_t& bounds = state->bounds;
+        uint32_t roundAreas[ssn::team::_length] = { 0, 0, 0 };
+        for( uint32_t areaIdx = 0; areaIdx < bounds.mAreaCount; areaIdx++ ) {
+            roundAreas[bounds.mAreaTeams[areaIdx]]++;
+        }
+        for( uint32_t team = 0; team < ssn::team::_length; team++ ) {
+            result->areas[team] += roundAreas[team];
+        }
+
+        // NOTE(JRC): Winners are decided by claimed area count rather than the
+        // sampled area tally of 'ssn::mode::score' to keep rounds cheap.
+        const uint32_t cRoundWinner =
+            ( roundAreas[ssn::team::left] > roundAreas[ssn::team::right] ) ? ssn::team::left : (
+            ( roundAreas[ssn::team::left] < roundAreas[ssn::team::right] ) ? ssn::team::right : (
+            ssn::team::neutral) );
+        result->wins[cRoundWinner]++;
+        result->rounds++;
+    }
+}
+
+}
@@ -0,0 +1,105 @@
+#ifndef SSN_RUNNER_T_H
+#define SSN_RUNNER_T_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rng_t.h"
+
+#include "ssn.h"
+#include "ssn_heatmap_t.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+class runner_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t CACHE_LINE_BYTES = 64;
+
+    /// Class Types ///
+
+    typedef void (*policy_f)( const ssn::state_t* pState, llce::rng_t* pRNG, ssn::actions_t* pActions );
+
+    struct result_t {
+        uint64_t rounds;
+        uint64_t ticks;
+        uint64_t areas[ssn::team::_length]; // units: claimed areas per team
+        uint64_t wins[ssn::team::_length];  // units: rounds won per team (neutral: ties)
+    };
+
+    struct alignas(CACHE_LINE_BYTES) match_t {
+        ssn::state_t state;
+        ssn::input_t input;
+        llce::rng_t rng; // policy random number generator
+        uint64_t rounds; // units: rounds assigned for the current run
+        result_t result;
+        ssn::heatmap_t heatmap; // units: positions sampled over the current run
+    };
+
+    struct alignas(CACHE_LINE_BYTES) queue_t {
+        std::atomic<uint32_t> next;
+        uint32_t end;
+    };
+
+    /// Constructors ///
+
+    runner_t( const uint32_t pMatchCount, const uint32_t pThreadCount = 0,
+        const uint64_t pSeed = ssn::RNG_SEED );
+    ~runner_t();
+
+    runner_t( const runner_t& ) = delete;
+    runner_t& operator=( const runner_t& ) = delete;
+
+    /// Class Functions ///
+
+    result_t run( const uint64_t pRoundCount, const float64_t pDT,
+        const ssn::stage_e pStage, const ssn::format_e pFormat = ssn::format::duel,
+        const policy_f pPolicy = nullptr );
+
+    void heatmap( ssn::heatmap_t* pHeatmap ) const;
+
+    static void policyRandom( const ssn::state_t* pState, llce::rng_t* pRNG, ssn::actions_t* pActions );
+    static void policyBot( const ssn::state_t* pState, llce::rng_t* pRNG, ssn::actions_t* pActions );
+
+    /// Helper Functions ///
+
+    private:
+
+    void work( const uint32_t pWorkerIdx );
+    void play( match_t* pMatch );
+
+    /// Class Fields ///
+
+    public:
+
+    match_t* mMatches;
+    uint32_t mMatchCount;
+
+    private:
+
+    std::vector<std::thread> mWorkers;
+    queue_t* mQueues;
+    uint32_t mWorkerCount;
+
+    float64_t mDT;
+    ssn::stage_e mStage;
+    ssn::format_e mFormat;
+    policy_f mPolicy;
+
+    std::mutex mPoolMutex;
+    std::condition_variable mPoolStartCV, mPoolDoneCV;
+    uint64_t mPoolGeneration;
+    uint32_t mPoolActiveCount;
+    bool32_t mPoolExiting;
+};
+
+}
+
+#endif
@@ -0,0 +1,160 @@
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+#include "ssn_scratch.h"
+
+namespace ssn {
+
+namespace scratch {
+
+/// Constants ///
+
+// NOTE(JRC): The bulk of the remaining state is the fixed-capacity simulation
+// (entity store, broadphase, pucks and paddles), which has to persist between
+// the game and score modes and be captured whole by snapshots and replays.
+constexpr static uint32_t STATE_BYTES_BUDGET = 40 * 1024;
+static_assert( sizeof(ssn::state_t) <= STATE_BYTES_BUDGET,
+    "Insufficient state budget; please move large mode-specific buffers "
+    "from 'ssn::state_t' into 'ssn::scratch' or raise the budget." );
+
+constexpr static uint32_t ARENA_BLOCK_SIZE = 64; // units: arenas
+constexpr static uint32_t MAX_BLOCK_COUNT = 64;  // units: arena blocks
+
+/// Types ///
+
+// NOTE(JRC): 'mEpoch' is published last (and cleared first), so a reader that
+// sees an arena's epoch also sees the owner and memory written before it.
+struct arena_t {
+    std::atomic<const ssn::state_t*> mOwner; // address of the state that acquired the arena
+    std::atomic<uint64_t> mEpoch;            // acquisition epoch; 0 if the arena is unused
+    void* mMemory;
+};
+
+/// Global Variables ///
+
+// NOTE(JRC): Arenas are owned by the module rather than 'ssn::state_t', so they
+// don't survive hot reloads, and they're keyed on the address of the state that
+// acquired them, so copies of a state (e.g. snapshots, keyframes) never alias
+// the original's arena. 'ssn::state_t::scratch' holds the acquisition epoch so
+// that stale handles (e.g. a state restored over its old address) are detected.
+// Each concurrently simulated state (e.g. in 'ssn::runner_t') gets its own arena;
+// arenas are allocated in blocks as needed and are never taken from a live state.
+static std::atomic<arena_t*> sArenaBlocks[MAX_BLOCK_COUNT];
+static uint64_t sArenaEpoch = 0;
+static std::mutex sArenaMutex;
+
+/// Helper Functions ///
+
+static arena_t* find( const ssn::state_t* pState ) {
+    const uint32_t cSlot = pState->scratch.mSlot;
+    arena_t* block = ( pState->scratch.mEpoch != 0 && cSlot < MAX_BLOCK_COUNT * ARENA_BLOCK_SIZE ) ?
+        sArenaBlocks[cSlot / ARENA_BLOCK_SIZE].load( std::memory_order_acquire ) : nullptr;
+    arena_t* arena = ( block != nullptr ) ? &block[cSlot % ARENA_BLOCK_SIZE] : nullptr;
+    return ( arena != nullptr &&
+        arena->mEpoch.load(std::memory_order_acquire) == pState->scratch.mEpoch &&
+        arena->mOwner.load(std::memory_order_relaxed) == pState ) ? arena : nullptr;
+}
+
+
+static void clear() {
+    std::lock_guard<std::mutex> arenaLock( sArenaMutex );
+    for( uint32_t blockIdx = 0; blockIdx < MAX_BLOCK_COUNT; blockIdx++ ) {
+        arena_t* block = sArenaBlocks[blockIdx].exchange( nullptr );
+        for( uint32_t arenaIdx = 0; block != nullptr && arenaIdx < ARENA_BLOCK_SIZE; arenaIdx++ ) {
+            std::free( block[arenaIdx].mMemory );
+        }
+        delete[] block;
+    }
+}
+
+/// Functions ///
+
+void* acquire( ssn::state_t* pState, const uint32_t pBytes ) {
+    release( pState );
+
+    std::lock_guard<std::mutex> arenaLock( sArenaMutex );
+
+    arena_t* arena = nullptr;
+    uint32_t arenaSlot = 0;
+    for( uint32_t blockIdx = 0; blockIdx < MAX_BLOCK_COUNT && arena == nullptr; blockIdx++ ) {
+        arena_t* block = sArenaBlocks[blockIdx].load( std::memory_order_relaxed );
+        if( block == nullptr ) {
+            block = new arena_t[ARENA_BLOCK_SIZE]();
+            sArenaBlocks[blockIdx].store( block, std::memory_order_release );
+        }
+        for( uint32_t arenaIdx = 0; arenaIdx < ARENA_BLOCK_SIZE && arena == nullptr; arenaIdx++ ) {
+            if( block[arenaIdx].mEpoch.load(std::memory_order_relaxed) == 0 ) {
+                arena = &block[arenaIdx];
+                arenaSlot = blockIdx * ARENA_BLOCK_SIZE + arenaIdx;
+            }
+        }
+    }
+
+    // NOTE(JRC): States that are discarded without a 'release' leave their
+    // arenas behind, so running out of arenas indicates a leak.
+    LLCE_CHECK_WARNING( arena != nullptr,
+        "Couldn't acquire mode scratch memory; all " << MAX_BLOCK_COUNT * ARENA_BLOCK_SIZE <<
+        " scratch arenas are held by live (or unreleased) states." );
+    void* memory = ( arena != nullptr ) ? std::calloc( 1, pBytes ) : nullptr;
+    LLCE_CHECK_WARNING( arena == nullptr || memory != nullptr,
+        "Couldn't acquire " << pBytes << " bytes of mode scratch memory." );
+    if( memory == nullptr ) {
+        return nullptr;
+    }
+
+    arena->mMemory = memory;
+    arena->mOwner.store( pState, std::memory_order_relaxed );
+    arena->mEpoch.store( ++sArenaEpoch, std::memory_order_release );
+    pState->scratch.mEpoch = sArenaEpoch;
+    pState->scratch.mBytes = pBytes;
+    pState->scratch.mSlot = arenaSlot;
+    return memory;
+}
+
+
+void release( ssn::state_t* pState ) {
+    {
+        std::lock_guard<std::mutex> arenaLock( sArenaMutex );
+        arena_t* arena = find( pState );
+        if( arena != nullptr ) {
+            arena->mEpoch.store( 0, std::memory_order_release );
+            arena->mOwner.store( nullptr, std::memory_order_relaxed );
+            std::free( arena->mMemory );
+            arena->mMemory = nullptr;
+        }
+    }
+
+    pState->scratch.mEpoch = 0;
+    pState->scratch.mBytes = 0;
+    pState->scratch.mSlot = 0;
+}
+
+
+// NOTE(JRC): Modes call this every frame, so it doesn't lock; a state's arena
+// is only ever acquired and released through that state (i.e. on the thread
+// that simulates it), so its slot can't change underneath this lookup.
+void* get( const ssn::state_t* pState, const uint32_t pBytes ) {
+    if( pState->scratch.mEpoch == 0 || pState->scratch.mBytes != pBytes ) {
+        return nullptr;
+    }
+
+    const arena_t* cArena = find( pState );
+    return ( cArena != nullptr ) ? cArena->mMemory : nullptr;
+}
+
+
+bool32_t valid( const ssn::state_t* pState ) {
+    return pState->scratch.mBytes == 0 ||
+        get( pState, pState->scratch.mBytes ) != nullptr;
+}
+
+/// Global Guards ///
+
+// NOTE(JRC): Arenas can't outlive this module (its successor after a hot reload
+// can't find them), so they're all freed when it's unloaded.
+static struct guard_t { ~guard_t() { clear(); } } sGuard;
+
+}
+
+}
@@ -0,0 +1,63 @@
+#ifndef SSN_SCRATCH_H
+#define SSN_SCRATCH_H
+
+#include "gui.h"
+
+#include "ssn.h"
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+namespace scratch {
+
+/// Types ///
+
+// NOTE(JRC): Large buffers that are only needed while a particular mode is
+// active live in these per-mode scratch types rather than in 'ssn::state_t'.
+// Scratch memory is acquired by each mode's 'init' function and released on
+// every mode transition (see 'update' in 'ssn.cpp').
+
+struct title_t {
+    llce::gui::menu_t menu;
+};
+
+struct bind_t {
+    llce::gui::bind_menu_t menu;
+};
+
+struct score_t {
+    bit8_t samples[SCORE_SAMPLES_BYTES];
+    bool32_t tallied;
+    float32_t tallyPoss[2];
+    uint32_t tallyColumns[2]; // units: sample columns tallied from the left/right edge
+};
+
+struct reset_t {
+    llce::gui::menu_t menu;
+    bool8_t updated;
+};
+
+/// Functions ///
+
+void* acquire( ssn::state_t* pState, const uint32_t pBytes );
+void release( ssn::state_t* pState );
+
+void* get( const ssn::state_t* pState, const uint32_t pBytes );
+bool32_t valid( const ssn::state_t* pState );
+
+template <typename T>
+T* acquire( ssn::state_t* pState ) {
+    return static_cast<T*>( acquire(pState, sizeof(T)) );
+}
+
+template <typename T>
+T* get( const ssn::state_t* pState ) {
+    return static_cast<T*>( get(pState, sizeof(T)) );
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <bitset>
+#include <cstdlib>
+#include <cstring>
+
+#include "ssn_snapshot_ring_t.h"
+
+namespace ssn {
+
+/// Helper Functions ///
+
+static uint32_t block_length( const uint32_t pBlock ) {
+    const uint32_t cOffset = pBlock * snapshot_ring_t::BLOCK_BYTES;
+    return std::min( snapshot_ring_t::BLOCK_BYTES,
+        static_cast<uint32_t>(sizeof(ssn::state_t)) - cOffset );
+}
+
+/// Class Functions ///
+
+snapshot_ring_t::snapshot_ring_t() {
+    mKeyframes = static_cast<bit8_t*>( std::malloc(
+        KEYFRAME_COUNT * sizeof(ssn::state_t)) );
+    mBlocks = static_cast<bit8_t*>( std::malloc(
+        KEYFRAME_COUNT * GROUP_BLOCK_COUNT * BLOCK_BYTES) );
+    clear();
+}
+
+
+snapshot_ring_t::~snapshot_ring_t() {
+    std::free( mBlocks );
+    std::free( mKeyframes );
+}
+
+
+void snapshot_ring_t::clear() {
+    std::memset( mFrames, 0, sizeof(mFrames) );
+    std::memset( mGroups, 0, sizeof(mGroups) );
+    mFrameCount = 0;
+    mGeneration = 0;
+    mCurrGroup = 0;
+}
+
+
+void snapshot_ring_t::capture( const ssn::state_t* pState ) {
+    const bit8_t* cState = reinterpret_cast<const bit8_t*>( pState );
+    frame_t& frame = mFrames[mFrameCount % FRAME_COUNT];
+    group_t* group = &mGroups[mCurrGroup];
+
+    bool32_t isKeyframe = mFrameCount == 0 ||
+        mFrameCount - group->mFirstFrame >= KEYFRAME_INTERVAL;
+
+    uint32_t changedCount = 0;
+    if( !isKeyframe ) {
+        const bit8_t* cKeyframe = keyframe( mCurrGroup );
+        std::memset( frame.mMask, 0, sizeof(frame.mMask) );
+        for( uint32_t blockIdx = 0; blockIdx < BLOCK_COUNT; blockIdx++ ) {
+            const uint32_t cOffset = blockIdx * BLOCK_BYTES;
+            if( std::memcmp(&cState[cOffset], &cKeyframe[cOffset], block_length(blockIdx)) != 0 ) {
+                frame.mMask[blockIdx / 64] |= 1ull << ( blockIdx % 64 );
+                changedCount++;
+            }
+        }
+        isKeyframe = group->mBlockCount + changedCount > GROUP_BLOCK_COUNT;
+    }
+
+    if( isKeyframe ) {
+        mCurrGroup = ( mFrameCount == 0 ) ? 0 : ( mCurrGroup + 1 ) % KEYFRAME_COUNT;
+        group = &mGroups[mCurrGroup];
+        group->mGeneration = ++mGeneration;
+        group->mFirstFrame = mFrameCount;
+        group->mBlockCount = 0;
+
+        std::memcpy( keyframe(mCurrGroup), cState, sizeof(ssn::state_t) );
+        std::memset( frame.mMask, 0, sizeof(frame.mMask) );
+    }
+
+    frame.mGeneration = group->mGeneration;
+    frame.mGroup = mCurrGroup;
+    frame.mBlockStart = group->mBlockCount;
+    for( uint32_t blockIdx = 0; blockIdx < BLOCK_COUNT && changedCount > 0 && !isKeyframe; blockIdx++ ) {
+        if( frame.mMask[blockIdx / 64] & (1ull << (blockIdx % 64)) ) {
+            std::memcpy( block(mCurrGroup, group->mBlockCount++),
+                &cState[blockIdx * BLOCK_BYTES], block_length(blockIdx) );
+        }
+    }
+
+    mFrameCount++;
+}
+
+
+bool32_t snapshot_ring_t::restore( const uint32_t pFramesAgo, ssn::state_t* pState ) const {
+    const frame_t* cFrame = frame( pFramesAgo );
+    if( cFrame == nullptr ) {
+        return false;
+    }
+
+    bit8_t* state = reinterpret_cast<bit8_t*>( pState );
+    std::memcpy( state, keyframe(cFrame->mGroup), sizeof(ssn::state_t) );
+
+    uint32_t poolIdx = cFrame->mBlockStart;
+    for( uint32_t wordIdx = 0; wordIdx < MASK_WORD_COUNT; wordIdx++ ) {
+        uint64_t maskWord = cFrame->mMask[wordIdx];
+        for( uint32_t bitIdx = 0; maskWord != 0; bitIdx++, maskWord >>= 1 ) {
+            if( maskWord & 1 ) {
+                const uint32_t cBlockIdx = 64 * wordIdx + bitIdx;
+                std::memcpy( &state[cBlockIdx * BLOCK_BYTES],
+                    block(cFrame->mGroup, poolIdx++), block_length(cBlockIdx) );
+            }
+        }
+    }
+
+    return true;
+}
+
+
+bool32_t snapshot_ring_t::rewind( const uint32_t pFramesAgo, ssn::state_t* pState ) {
+    if( !restore(pFramesAgo, pState) ) {
+        return false;
+    }
+
+    // NOTE(JRC): Frames after the restored frame are discarded so that the
+    // next capture continues the restored frame's group (and its block pool).
+    const frame_t* cFrame = frame( pFramesAgo );
+    uint32_t frameBlockCount = 0;
+    for( uint32_t wordIdx = 0; wordIdx < MASK_WORD_COUNT; wordIdx++ ) {
+        frameBlockCount += static_cast<uint32_t>( std::bitset<64>(cFrame->mMask[wordIdx]).count() );
+    }
+
+    mFrameCount -= pFramesAgo;
+    mCurrGroup = cFrame->mGroup;
+    mGroups[mCurrGroup].mBlockCount = cFrame->mBlockStart + frameBlockCount;
+    for( uint32_t groupIdx = 0; groupIdx < KEYFRAME_COUNT; groupIdx++ ) {
+        group_t& group = mGroups[groupIdx];
+        group.mGeneration = ( group.mFirstFrame >= mFrameCount ) ? 0 : group.mGeneration;
+    }
+
+    return true;
+}
+
+
+uint32_t snapshot_ring_t::count() const {
+    uint64_t firstFrame = mFrameCount;
+    for( uint32_t groupIdx = 0; groupIdx < KEYFRAME_COUNT; groupIdx++ ) {
+        const group_t& group = mGroups[groupIdx];
+        firstFrame = ( group.mGeneration != 0 ) ? std::min( firstFrame, group.mFirstFrame ) : firstFrame;
+    }
+    return static_cast<uint32_t>( std::min<uint64_t>(mFrameCount - firstFrame, FRAME_COUNT) );
+}
+
+/// Helper Functions ///
+
+bit8_t* snapshot_ring_t::keyframe( const uint32_t pGroup ) const {
+    return &mKeyframes[pGroup * sizeof(ssn::state_t)];
+}
+
+
+bit8_t* snapshot_ring_t::block( const uint32_t pGroup, const uint32_t pBlock ) const {
+    return &mBlocks[( pGroup * GROUP_BLOCK_COUNT + pBlock ) * BLOCK_BYTES];
+}
+
+
+const snapshot_ring_t::frame_t* snapshot_ring_t::frame( const uint32_t pFramesAgo ) const {
+    if( pFramesAgo >= mFrameCount || pFramesAgo >= FRAME_COUNT ) {
+        return nullptr;
+    }
+
+    const frame_t* cFrame = &mFrames[( mFrameCount - 1 - pFramesAgo ) % FRAME_COUNT];
+    return ( mGroups[cFrame->mGroup].mGeneration == cFrame->mGeneration ) ? cFrame : nullptr;
+}
+
+}
@@ -0,0 +1,84 @@
+#ifndef SSN_SNAPSHOT_RING_T_H
+#define SSN_SNAPSHOT_RING_T_H
+
+#include "ssn.h"
+#include "consts.h"
+
+namespace ssn {
+
+class snapshot_ring_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t BLOCK_BYTES = 256;
+    constexpr static uint32_t BLOCK_COUNT = ( sizeof(ssn::state_t) + BLOCK_BYTES - 1 ) / BLOCK_BYTES;
+    constexpr static uint32_t MASK_WORD_COUNT = ( BLOCK_COUNT + 63 ) / 64;
+
+    constexpr static uint32_t KEYFRAME_INTERVAL = 32; // units: frames per keyframe
+    constexpr static uint32_t KEYFRAME_COUNT = 8;
+    constexpr static uint32_t FRAME_COUNT = KEYFRAME_INTERVAL * KEYFRAME_COUNT;
+    // NOTE(JRC): Each keyframe group has a fixed pool of delta blocks sized for
+    // an average of 1/8th of the state changing per frame; groups that exhaust
+    // their pool end early and start a new keyframe.
+    constexpr static uint32_t GROUP_BLOCK_COUNT = KEYFRAME_INTERVAL * BLOCK_COUNT / 8;
+
+    /// Class Types ///
+
+    struct frame_t {
+        uint64_t mMask[MASK_WORD_COUNT]; // bit 'i' set if block 'i' differs from the keyframe
+        uint64_t mGeneration;            // generation of the group at capture time
+        uint32_t mGroup;
+        uint32_t mBlockStart;            // units: index into the group's block pool
+    };
+
+    struct group_t {
+        uint64_t mGeneration;
+        uint64_t mFirstFrame; // units: index of the group's keyframe in the capture sequence
+        uint32_t mBlockCount; // units: blocks used in the group's block pool
+    };
+
+    /// Constructors ///
+
+    snapshot_ring_t();
+    ~snapshot_ring_t();
+
+    snapshot_ring_t( const snapshot_ring_t& ) = delete;
+    snapshot_ring_t& operator=( const snapshot_ring_t& ) = delete;
+
+    /// Class Functions ///
+
+    void clear();
+
+    void capture( const ssn::state_t* pState );
+    bool32_t restore( const uint32_t pFramesAgo, ssn::state_t* pState ) const;
+    bool32_t rewind( const uint32_t pFramesAgo, ssn::state_t* pState );
+
+    uint32_t count() const;
+
+    /// Helper Functions ///
+
+    private:
+
+    bit8_t* keyframe( const uint32_t pGroup ) const;
+    bit8_t* block( const uint32_t pGroup, const uint32_t pBlock ) const;
+    const frame_t* frame( const uint32_t pFramesAgo ) const;
+
+    /// Class Fields ///
+
+    private:
+
+    bit8_t* mKeyframes; // units: 'KEYFRAME_COUNT' raw 'ssn::state_t' copies
+    bit8_t* mBlocks;    // units: 'KEYFRAME_COUNT' pools of 'GROUP_BLOCK_COUNT' blocks
+
+    frame_t mFrames[FRAME_COUNT];
+    group_t mGroups[KEYFRAME_COUNT];
+
+    uint64_t mFrameCount; // units: frames captured since the last clear
+    uint64_t mGeneration;
+    uint32_t mCurrGroup;
+};
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef SSN_SPSC_RING_T_HPP
+#define SSN_SPSC_RING_T_HPP
+
+#include <atomic>
+
+#include "consts.h"
+
+namespace ssn {
+
+/// Class Declarations ///
+
+// NOTE(JRC): A bounded, lock-free ring buffer for exactly one producer thread and
+// one consumer thread. The head and tail indices only ever increase (wrapping is
+// done on access), and each is written by a single side, so the only
+// synchronization required is an acquire/release pair per operation.
+template <typename T, uint32_t N>
+class spsc_ring_t {
+    public:
+
+    /// Class Attributes ///
+
+    constexpr static uint32_t CAPACITY = N;
+    constexpr static uint32_t CACHE_LINE_BYTES = 64;
+
+    static_assert( N != 0 && (N & (N - 1)) == 0,
+        "Invalid ring capacity; please use a power of 2 for the capacity of 'ssn::spsc_ring_t'." );
+
+    /// Constructors ///
+
+    spsc_ring_t() : mHead( 0 ), mTail( 0 ) {}
+
+    spsc_ring_t( const spsc_ring_t& ) = delete;
+    spsc_ring_t& operator=( const spsc_ring_t& ) = delete;
+
+    /// Producer Functions ///
+
+    bool32_t push( const T& pValue ) {
+        const uint32_t cTail = mTail.load( std::memory_order_relaxed );
+        if( cTail - mHead.load(std::memory_order_acquire) >= N ) {
+            return false;
+        }
+
+        mValues[cTail & (N - 1)] = pValue;
+        mTail.store( cTail + 1, std::memory_order_release );
+        return true;
+    }
+
+    /// Consumer Functions ///
+
+    uint32_t pop( T* pValues, const uint32_t pMaxCount ) {
+        const uint32_t cHead = mHead.load( std::memory_order_relaxed );
+        const uint32_t cAvailable = mTail.load( std::memory_order_acquire ) - cHead;
+        const uint32_t cCount = ( cAvailable < pMaxCount ) ? cAvailable : pMaxCount;
+
+        for( uint32_t valueIdx = 0; valueIdx < cCount; valueIdx++ ) {
+            pValues[valueIdx] = mValues[( cHead + valueIdx ) & (N - 1)];
+        }
+        mHead.store( cHead + cCount, std::memory_order_release );
+        return cCount;
+    }
+
+    bool32_t empty() const {
+        return mHead.load( std::memory_order_acquire ) == mTail.load( std::memory_order_acquire );
+    }
+
+    /// Class Fields ///
+
+    private:
+
+    // NOTE(JRC): The indices are kept on separate cache lines so that the
+    // producer and consumer don't contend over the same line.
+    alignas(CACHE_LINE_BYTES) std::atomic<uint32_t> mHead;
+    alignas(CACHE_LINE_BYTES) std::atomic<uint32_t> mTail;
+    alignas(CACHE_LINE_BYTES) T mValues[N];
+};
+
+}
+
+#endif
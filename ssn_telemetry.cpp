@@ -0,0 +1,186 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "ssn_spsc_ring_t.hpp"
+#include "ssn_telemetry.h"
+
+namespace ssn {
+
+namespace telemetry {
+
+/// Constants ///
+
+constexpr static uint32_t RING_CAPACITY = 1 << 14; // units: records
+constexpr static uint32_t BATCH_CAPACITY = 1 << 10; // units: records
+constexpr static std::chrono::milliseconds WRITER_PERIOD( 10 );
+
+static_assert( sizeof(record_t) == 32,
+    "Incorrect telemetry record size; please keep 'ssn::telemetry::record_t' "
+    "packed to 32 bytes so logs stay compact and aligned." );
+
+/// Global Variables ///
+
+static ssn::spsc_ring_t<record_t, RING_CAPACITY> sRing;
+static std::atomic<uint64_t> sDropped( 0 );
+static std::atomic<bool32_t> sActive( false );
+static std::atomic<bool32_t> sStopping( false );
+static std::thread sWriter;
+static std::FILE* sFile = nullptr;
+
+/// Helper Functions ///
+
+static void drain( record_t* pBatch ) {
+    for( uint32_t batchCount = sRing.pop( pBatch, BATCH_CAPACITY );
+            batchCount > 0;
+            batchCount = sRing.pop(pBatch, BATCH_CAPACITY) ) {
+        std::fwrite( pBatch, sizeof(record_t), batchCount, sFile );
+    }
+}
+
+
+static void write() {
+    // NOTE(JRC): The batch buffer is static rather than on the stack since
+    // it's too large for some default thread stack sizes.
+    static record_t sBatch[BATCH_CAPACITY];
+
+    while( !sStopping.load(std::memory_order_acquire) ) {
+        drain( &sBatch[0] );
+        std::this_thread::sleep_for( WRITER_PERIOD );
+    }
+    drain( &sBatch[0] );
+}
+
+
+static void emit( const record_t& pRecord ) {
+    if( sActive.load(std::memory_order_relaxed) && !sRing.push(pRecord) ) {
+        sDropped.fetch_add( 1, std::memory_order_relaxed );
+    }
+}
+
+
+static record_t record( const event_e pType, const float64_t pTime ) {
+    record_t record;
+    std::memset( &record, 0, sizeof(record) );
+    record.mType = static_cast<uint8_t>( pType );
+    record.mTime = pTime;
+    return record;
+}
+
+/// Functions ///
+
+bool32_t start( const char8_t* pPath, const bool32_t pAppend ) {
+    if( sActive.load() ) {
+        stop();
+    }
+
+    sFile = std::fopen( pPath, pAppend ? "ab" : "wb" );
+    LLCE_CHECK_WARNING( sFile != nullptr,
+        "Couldn't start telemetry; failed to open file '" << pPath << "' for writing." );
+    if( sFile == nullptr ) {
+        return false;
+    }
+
+    // NOTE(JRC): Appended logs already have a header unless they're empty.
+    std::fseek( sFile, 0, SEEK_END );
+    if( std::ftell(sFile) == 0 ) {
+        const header_t cHeader = { MAGIC, VERSION, sizeof(record_t), 0 };
+        std::fwrite( &cHeader, sizeof(cHeader), 1, sFile );
+    }
+
+    sDropped.store( 0 );
+    sStopping.store( false );
+    sWriter = std::thread( write );
+    sActive.store( true, std::memory_order_release );
+    return true;
+}
+
+
+uint64_t stop() {
+    if( !sActive.load() ) {
+        return 0;
+    }
+
+    sActive.store( false, std::memory_order_release );
+    sStopping.store( true, std::memory_order_release );
+    sWriter.join();
+
+    const uint64_t cDropped = sDropped.load();
+    if( cDropped > 0 ) {
+        record_t droppedRecord = record( event::dropped, 0.0 );
+        droppedRecord.mValue = cDropped;
+        std::fwrite( &droppedRecord, sizeof(droppedRecord), 1, sFile );
+    }
+    LLCE_CHECK_WARNING( cDropped == 0,
+        "Telemetry ring buffer overflowed; " << cDropped << " events were dropped." );
+
+    std::fclose( sFile );
+    sFile = nullptr;
+    return cDropped;
+}
+
+
+bool32_t active() {
+    return sActive.load( std::memory_order_relaxed );
+}
+
+
+void hit( const float64_t pTime, const uint32_t pPuck, const uint32_t pPaddle,
+        const uint8_t pTeam, const vec2f32_t& pPos ) {
+    record_t hitRecord = record( event::hit, pTime );
+    hitRecord.mSubjects[0] = static_cast<uint16_t>( pPuck );
+    hitRecord.mSubjects[1] = static_cast<uint16_t>( pPaddle );
+    hitRecord.mTeam = pTeam;
+    hitRecord.mPos[0] = pPos.x; hitRecord.mPos[1] = pPos.y;
+    emit( hitRecord );
+}
+
+
+void claim( const float64_t pTime, const uint32_t pArea, const uint8_t pTeam ) {
+    record_t claimRecord = record( event::claim, pTime );
+    claimRecord.mSubjects[0] = static_cast<uint16_t>( pArea );
+    claimRecord.mTeam = pTeam;
+    emit( claimRecord );
+}
+
+
+void rush( const float64_t pTime, const uint32_t pPaddle,
+        const uint8_t pTeam, const vec2f32_t& pPos ) {
+    record_t rushRecord = record( event::rush, pTime );
+    rushRecord.mSubjects[0] = static_cast<uint16_t>( pPaddle );
+    rushRecord.mTeam = pTeam;
+    rushRecord.mPos[0] = pPos.x; rushRecord.mPos[1] = pPos.y;
+    emit( rushRecord );
+}
+
+
+void wrap( const float64_t pTime, const uint32_t pPuck,
+        const vec2i8_t& pDirection, const vec2f32_t& pPos ) {
+    record_t wrapRecord = record( event::wrap, pTime );
+    wrapRecord.mSubjects[0] = static_cast<uint16_t>( pPuck );
+    wrapRecord.mValue = static_cast<uint64_t>( static_cast<uint8_t>(pDirection.x) ) |
+        ( static_cast<uint64_t>(static_cast<uint8_t>(pDirection.y)) << 8 );
+    wrapRecord.mPos[0] = pPos.x; wrapRecord.mPos[1] = pPos.y;
+    emit( wrapRecord );
+}
+
+
+void mode( const float64_t pTime, const int32_t pFromMode, const int32_t pToMode ) {
+    record_t modeRecord = record( event::mode, pTime );
+    modeRecord.mSubjects[0] = static_cast<uint16_t>( static_cast<int16_t>(pFromMode) );
+    modeRecord.mSubjects[1] = static_cast<uint16_t>( static_cast<int16_t>(pToMode) );
+    emit( modeRecord );
+}
+
+/// Global Guards ///
+
+// NOTE(JRC): A joinable 'std::thread' terminates the process when destroyed,
+// and static objects are destroyed when this module is unloaded (e.g. on hot
+// reloads and exit), so this guard joins the writer and flushes the log first.
+static struct guard_t { ~guard_t() { stop(); } } sGuard;
+
+}
+
+}
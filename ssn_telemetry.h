@@ -0,0 +1,66 @@
+#ifndef SSN_TELEMETRY_H
+#define SSN_TELEMETRY_H
+
+#include "ssn_consts.h"
+#include "consts.h"
+
+namespace ssn {
+
+namespace telemetry {
+
+/// Constants ///
+
+constexpr static uint32_t MAGIC = 0x544e5353; // units: 'SSNT' (little endian)
+constexpr static uint32_t VERSION = 1;
+
+LLCE_ENUM( event, hit, claim, rush, wrap, mode, dropped );
+
+/// Types ///
+
+// NOTE(JRC): Logs are a 'header_t' followed by a flat sequence of 'record_t'
+// values; the 'dropped' record written on 'stop' (if any) gives the number
+// of events that were discarded because the ring buffer was full.
+struct header_t {
+    uint32_t mMagic;
+    uint32_t mVersion;
+    uint32_t mRecordBytes;
+    uint32_t mReserved;
+};
+
+struct record_t {
+    float64_t mTime;     // units: seconds (total time)
+    uint64_t mValue;     // units: event-specific (e.g. mode id, dropped count)
+    float32_t mPos[2];   // units: world
+    uint16_t mSubjects[2]; // units: event-specific indices (e.g. puck, paddle)
+    uint8_t mType;       // units: 'event_e'
+    uint8_t mTeam;
+    uint8_t mReserved[2];
+};
+
+/// Functions ///
+
+// NOTE(JRC): Events may only be emitted from a single thread (the thread that
+// runs the simulation); all file I/O happens on a background writer thread
+// started by 'start', so emitting an event only copies a record into a
+// fixed-size ring buffer and never allocates or blocks.
+
+// NOTE(JRC): Logs are appended to (rather than replaced) when 'pAppend' is set,
+// which lets a session's log continue across hot reloads.
+bool32_t start( const char8_t* pPath, const bool32_t pAppend = false );
+uint64_t stop();
+bool32_t active();
+
+void hit( const float64_t pTime, const uint32_t pPuck, const uint32_t pPaddle,
+    const uint8_t pTeam, const vec2f32_t& pPos );
+void claim( const float64_t pTime, const uint32_t pArea, const uint8_t pTeam );
+void rush( const float64_t pTime, const uint32_t pPaddle,
+    const uint8_t pTeam, const vec2f32_t& pPos );
+void wrap( const float64_t pTime, const uint32_t pPuck,
+    const vec2i8_t& pDirection, const vec2f32_t& pPos );
+void mode( const float64_t pTime, const int32_t pFromMode, const int32_t pToMode );
+
+}
+
+}
+
+#endif
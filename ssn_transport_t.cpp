@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "ssn_transport_t.h"
+
+namespace ssn {
+
+/// 'ssn::udp_transport_t' Functions ///
+
+udp_transport_t::udp_transport_t() : mSocket( -1 ) {
+
+}
+
+
+udp_transport_t::~udp_transport_t() {
+    close();
+}
+
+
+bool32_t udp_transport_t::open( const uint16_t pLocalPort, const char8_t* pPeerHost, const uint16_t pPeerPort ) {
+    close();
+
+    sockaddr_in localAddr, peerAddr;
+    std::memset( &localAddr, 0, sizeof(localAddr) );
+    localAddr.sin_family = AF_INET;
+    localAddr.sin_addr.s_addr = htonl( INADDR_ANY );
+    localAddr.sin_port = htons( pLocalPort );
+    std::memset( &peerAddr, 0, sizeof(peerAddr) );
+    peerAddr.sin_family = AF_INET;
+    peerAddr.sin_port = htons( pPeerPort );
+
+    // NOTE(JRC): The socket is connected to the peer so that datagrams from
+    // any other address are filtered out by the kernel.
+    mSocket = ::socket( AF_INET, SOCK_DGRAM, 0 );
+    const bool32_t cIsOpen = mSocket >= 0 &&
+        ::inet_pton( AF_INET, pPeerHost, &peerAddr.sin_addr ) == 1 &&
+        ::fcntl( mSocket, F_SETFL, ::fcntl(mSocket, F_GETFL, 0) | O_NONBLOCK ) == 0 &&
+        ::bind( mSocket, reinterpret_cast<const sockaddr*>(&localAddr), sizeof(localAddr) ) == 0 &&
+        ::connect( mSocket, reinterpret_cast<const sockaddr*>(&peerAddr), sizeof(peerAddr) ) == 0;
+    LLCE_CHECK_WARNING( cIsOpen,
+        "Couldn't open UDP transport from local port " << pLocalPort << " to peer " <<
+        "'" << pPeerHost << ":" << pPeerPort << "'." );
+    if( !cIsOpen ) {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+
+void udp_transport_t::close() {
+    if( mSocket >= 0 ) {
+        ::close( mSocket );
+    }
+    mSocket = -1;
+}
+
+
+bool32_t udp_transport_t::send( const bit8_t* pData, const uint32_t pBytes ) {
+    return mSocket >= 0 &&
+        ::send( mSocket, pData, pBytes, 0 ) == static_cast<ssize_t>( pBytes );
+}
+
+
+uint32_t udp_transport_t::recv( bit8_t* pData, const uint32_t pMaxBytes ) {
+    // NOTE(JRC): Errors (e.g. 'ECONNREFUSED' before the peer has bound its
+    // port) are treated the same as an empty queue; the protocol on top of
+    // the transport is expected to resend anything that matters.
+    const ssize_t cBytes = ( mSocket >= 0 ) ? ::recv( mSocket, pData, pMaxBytes, 0 ) : -1;
+    return ( cBytes > 0 ) ? static_cast<uint32_t>( cBytes ) : 0;
+}
+
+/// 'ssn::lag_transport_t' Functions ///
+
+lag_transport_t::lag_transport_t( transport_t* pBase, const float64_t pLatency, const float64_t pJitter,
+        const float32_t pLossChance, const llce::rng_t& pRNG ) :
+        mLatency( pLatency ), mJitter( pJitter ), mLossChance( pLossChance ),
+        mBase( pBase ), mRNG( pRNG ), mTime( 0.0 ) {
+
+}
+
+
+void lag_transport_t::update( const float64_t pDT ) {
+    mTime += pDT;
+
+    // NOTE(JRC): Datagrams are delivered in order of delivery time, which
+    // reorders them whenever the jitter exceeds the gap between two sends.
+    std::stable_sort( mPending.begin(), mPending.end(),
+        [] ( const datagram_t& pA, const datagram_t& pB ) { return pA.mTime < pB.mTime; } );
+    uint32_t deliverCount = 0;
+    for( ; deliverCount < mPending.size() && mPending[deliverCount].mTime <= mTime; deliverCount++ ) {
+        const datagram_t& datagram = mPending[deliverCount];
+        mBase->send( datagram.mData.data(), static_cast<uint32_t>(datagram.mData.size()) );
+    }
+    mPending.erase( mPending.begin(), mPending.begin() + deliverCount );
+}
+
+
+bool32_t lag_transport_t::send( const bit8_t* pData, const uint32_t pBytes ) {
+    if( mRNG.nextf() < mLossChance ) {
+        return true;
+    }
+
+    const float64_t cDelay = std::max( 0.0, mLatency + mJitter * (2.0 * mRNG.nextf() - 1.0) );
+    mPending.push_back( { mTime + cDelay, std::vector<bit8_t>(pData, pData + pBytes) } );
+    return true;
+}
+
+
+uint32_t lag_transport_t::recv( bit8_t* pData, const uint32_t pMaxBytes ) {
+    return mBase->recv( pData, pMaxBytes );
+}
+
+}
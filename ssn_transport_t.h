@@ -0,0 +1,104 @@
+#ifndef SSN_TRANSPORT_T_H
+#define SSN_TRANSPORT_T_H
+
+#include <vector>
+
+#include "rng_t.h"
+
+#include "ssn_data.h"
+#include "consts.h"
+
+namespace ssn {
+
+// NOTE(JRC): A transport is an unreliable, unordered datagram channel to a
+// single peer (i.e. UDP semantics); datagrams may be dropped, duplicated or
+// reordered, and both calls must return immediately (never block).
+class transport_t {
+    public:
+
+    /// Constructors ///
+
+    virtual ~transport_t() {}
+
+    /// Class Functions ///
+
+    virtual bool32_t send( const bit8_t* pData, const uint32_t pBytes ) = 0;
+    // NOTE(JRC): Returns the size of the received datagram, or 0 if none is pending.
+    virtual uint32_t recv( bit8_t* pData, const uint32_t pMaxBytes ) = 0;
+};
+
+
+class udp_transport_t : public transport_t {
+    public:
+
+    /// Constructors ///
+
+    udp_transport_t();
+    ~udp_transport_t();
+
+    udp_transport_t( const udp_transport_t& ) = delete;
+    udp_transport_t& operator=( const udp_transport_t& ) = delete;
+
+    /// Class Functions ///
+
+    // NOTE(JRC): Both peers of a loopback test use the host "127.0.0.1" and
+    // each other's local ports.
+    bool32_t open( const uint16_t pLocalPort, const char8_t* pPeerHost, const uint16_t pPeerPort );
+    void close();
+
+    bool32_t send( const bit8_t* pData, const uint32_t pBytes ) override;
+    uint32_t recv( bit8_t* pData, const uint32_t pMaxBytes ) override;
+
+    /// Class Fields ///
+
+    private:
+
+    int32_t mSocket;
+};
+
+
+// NOTE(JRC): Wraps another transport and holds each outgoing datagram for a
+// random delay of 'latency +/- jitter' (and drops some fraction of them
+// entirely) before passing it along. Delays are measured against a clock that
+// is advanced explicitly via 'update', so tests are reproducible.
+class lag_transport_t : public transport_t {
+    public:
+
+    /// Class Types ///
+
+    struct datagram_t {
+        float64_t mTime; // units: seconds (delivery time)
+        std::vector<bit8_t> mData;
+    };
+
+    /// Constructors ///
+
+    lag_transport_t( transport_t* pBase, const float64_t pLatency, const float64_t pJitter,
+        const float32_t pLossChance = 0.0f, const llce::rng_t& pRNG = llce::rng_t(ssn::RNG_SEED) );
+
+    /// Class Functions ///
+
+    void update( const float64_t pDT );
+
+    bool32_t send( const bit8_t* pData, const uint32_t pBytes ) override;
+    uint32_t recv( bit8_t* pData, const uint32_t pMaxBytes ) override;
+
+    /// Class Fields ///
+
+    public:
+
+    float64_t mLatency;     // units: seconds (one way)
+    float64_t mJitter;      // units: seconds (maximum deviation from latency)
+    float32_t mLossChance;  // units: probability in [0, 1]
+
+    private:
+
+    transport_t* mBase;
+    llce::rng_t mRNG;
+    float64_t mTime;        // units: seconds
+    std::vector<datagram_t> mPending;
+};
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+#include <cmath>
+
+#if !SSN_FIXED_POINT && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "ssn_wrap.h"
+
+namespace ssn {
+
+namespace wrap {
+
+/// Functions ///
+
+vec2r_t delta( const vec2r_t& pFrom, const vec2r_t& pTo,
+        const vec2r_t& pDims, vec2i8_t* pImage ) {
+    const real_t cHalf = ssn::real::tor( 0.5 );
+    const vec2r_t cDelta = pTo - pFrom;
+    const vec2r_t cImage(
+        -ssn::real::floor(cDelta.x / pDims.x + cHalf),
+        -ssn::real::floor(cDelta.y / pDims.y + cHalf) );
+
+    if( pImage != nullptr ) {
+        // NOTE(JRC): 'real_t' values are converted through 'int32_t' since
+        // 'ssn::fixed_t' only has explicit conversions to 32-bit types.
+        *pImage = vec2i8_t(
+            static_cast<int8_t>(static_cast<int32_t>(cImage.x)),
+            static_cast<int8_t>(static_cast<int32_t>(cImage.y)) );
+    }
+    return cDelta + cImage * pDims;
+}
+
+
+void deltas( const real_t* pFroms, const real_t* pTos, const uint32_t pCount,
+        const real_t pLength, real_t* pDeltas ) {
+    const real_t cHalf = ssn::real::tor( 0.5 );
+    uint32_t deltaIdx = 0;
+
+#if !SSN_FIXED_POINT && defined(__SSE2__)
+    // NOTE(JRC): SSE2 has no floor instruction, so lanes are truncated toward
+    // zero and then stepped down wherever truncation rounded up; this is exact
+    // for the quotients seen here, which are far below 2**31 in magnitude.
+    const __m128 cLengths = _mm_set1_ps( pLength );
+    const __m128 cHalves = _mm_set1_ps( cHalf );
+    const __m128 cOnes = _mm_set1_ps( 1.0f );
+    const __m128 cSigns = _mm_set1_ps( -0.0f );
+    for( ; deltaIdx + 4 <= pCount; deltaIdx += 4 ) {
+        const __m128 cDeltas = _mm_sub_ps(
+            _mm_loadu_ps(&pTos[deltaIdx]), _mm_loadu_ps(&pFroms[deltaIdx]) );
+        const __m128 cQuotients = _mm_add_ps( _mm_div_ps(cDeltas, cLengths), cHalves );
+        const __m128 cTruncs = _mm_cvtepi32_ps( _mm_cvttps_epi32(cQuotients) );
+        const __m128 cFloors = _mm_sub_ps( cTruncs,
+            _mm_and_ps(_mm_cmpgt_ps(cTruncs, cQuotients), cOnes) );
+        const __m128 cImages = _mm_xor_ps( cFloors, cSigns );
+        _mm_storeu_ps( &pDeltas[deltaIdx], _mm_add_ps(cDeltas, _mm_mul_ps(cImages, cLengths)) );
+    }
+#endif
+
+    for( ; deltaIdx < pCount; deltaIdx++ ) {
+        const real_t cDelta = pTos[deltaIdx] - pFroms[deltaIdx];
+        const real_t cImage = -ssn::real::floor( cDelta / pLength + cHalf );
+        pDeltas[deltaIdx] = cDelta + cImage * pLength;
+    }
+}
+
+
+int8_t straddle( const real_t pMin, const real_t pMax,
+        const real_t pContainerMin, const real_t pContainerMax ) {
+    return ( pMax > pContainerMax ) ? -1 : ( (pMin < pContainerMin) ? +1 : 0 );
+}
+
+
+uint32_t images( const llce::box_t& pBox, const llce::box_t& pContainer,
+        vec2i8_t pImages[MAX_IMAGE_COUNT] ) {
+    const vec2r_t cBoxMin = ssn::real::tor( pBox.min() ), cBoxMax = ssn::real::tor( pBox.max() );
+    const vec2r_t cContainerMin = ssn::real::tor( pContainer.min() );
+    const vec2r_t cContainerMax = ssn::real::tor( pContainer.max() );
+
+    const vec2i8_t cStraddle(
+        straddle(cBoxMin.x, cBoxMax.x, cContainerMin.x, cContainerMax.x),
+        straddle(cBoxMin.y, cBoxMax.y, cContainerMin.y, cContainerMax.y) );
+
+    uint32_t imageCount = 0;
+    pImages[imageCount++] = vec2i8_t( 0, 0 );
+    if( cStraddle.x != 0 ) {
+        pImages[imageCount++] = vec2i8_t( cStraddle.x, 0 );
+    } if( cStraddle.y != 0 ) {
+        pImages[imageCount++] = vec2i8_t( 0, cStraddle.y );
+    } if( cStraddle.x != 0 && cStraddle.y != 0 ) {
+        pImages[imageCount++] = cStraddle;
+    }
+
+    return imageCount;
+}
+
+}
+
+}
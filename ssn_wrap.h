@@ -0,0 +1,49 @@
+#ifndef SSN_WRAP_H
+#define SSN_WRAP_H
+
+#include "box_t.h"
+
+#include "ssn_real.hpp"
+#include "consts.h"
+
+namespace ssn {
+
+namespace wrap {
+
+/// Constants ///
+
+constexpr static uint32_t MAX_IMAGE_COUNT = 4;
+
+/// Functions ///
+
+// NOTE(JRC): All functions in this namespace operate on a torus the size of
+// the given container, where an "image" of a point is a copy of that point
+// translated by an integer multiple of the container's dimensions.
+
+// Returns the displacement from 'pFrom' to the nearest image of 'pTo', with
+// the image's translation (in container dimensions) optionally output.
+vec2r_t delta( const vec2r_t& pFrom, const vec2r_t& pTo,
+    const vec2r_t& pDims, vec2i8_t* pImage = nullptr );
+
+// Outputs the displacement from each 'pFroms[i]' to the nearest image of
+// 'pTos[i]' along a single container axis of the given length, matching the
+// corresponding component of 'delta' exactly (vectorized where supported).
+void deltas( const real_t* pFroms, const real_t* pTos, const uint32_t pCount,
+    const real_t pLength, real_t* pDeltas );
+
+// Returns the translation (in container dimensions) of the image of the given
+// interval that straddles the opposite side of the container along one axis,
+// or 0 if the interval lies within the container.
+int8_t straddle( const real_t pMin, const real_t pMax,
+    const real_t pContainerMin, const real_t pContainerMax );
+
+// Outputs the translations (in container dimensions) of all images of the
+// given box that intersect the container, returning the number of images.
+uint32_t images( const llce::box_t& pBox, const llce::box_t& pContainer,
+    vec2i8_t pImages[MAX_IMAGE_COUNT] );
+
+}
+
+}
+
+#endif